@@ -0,0 +1,341 @@
+#!/usr/bin/env python
+#
+# Strong and weak scaling harness around the installed GRINS examples.
+#
+# Each case input is copied into a run directory with the mesh uniformly
+# refined and the built-in profiler turned on, and is run over a range of
+# MPI rank counts. The profiling report (profile.json) of each run gives
+# the per-phase timings and the Newton/Krylov iteration counts; the results
+# are printed as a table and saved as JSON, optionally compared against a
+# previously saved baseline.
+#
+# Examples:
+#   scaling_benchmark.py --prefix=$GRINS_DIR --mode=strong --ranks=1,2,4,8 --refine=2
+#   scaling_benchmark.py --prefix=$GRINS_DIR --mode=weak --ranks=1,4,16 \
+#       --baseline=scaling_baseline.json
+#   scaling_benchmark.py --prefix=$GRINS_DIR --save-baseline=scaling_baseline.json
+#
+# Phases:
+#   mesh_build, init (equation system setup), assembly (residual and
+#   Jacobian), output (visualization), adapt (error estimation and mesh
+#   refinement), and linear_solve. The latter is estimated as
+#   solve - assembly - output - adapt, i.e. it also contains the (small)
+#   Newton bookkeeping.
+
+from __future__ import print_function
+
+import json
+import math
+import optparse
+import os
+import re
+import shlex
+import shutil
+import subprocess
+import sys
+import time
+
+# name: (executable relative to prefix, example directory, input file, dimension)
+CASES = { 'cavity_benchmark':
+              ('examples/cavity_benchmark/cavity', 'examples/cavity_benchmark', 'cavity.in', 2),
+          'backward_facing_step':
+              ('bin/grins', 'examples/backward_facing_step', 'backward_facing_step.in', 2),
+          'reacting_flow':
+              ('examples/reacting_flow/rlmns', 'examples/reacting_flow', 'rlmns.in', 2) }
+
+PHASES = [ 'mesh_build', 'init', 'assembly', 'linear_solve', 'output', 'adapt' ]
+
+
+def set_option( lines, section, key, value ):
+    """Set section/key = value in a GetPot input given as a list of lines.
+
+    section is the full path, e.g. 'mesh-options' or 'Physics/HeatTransfer'.
+    The key is replaced where it is defined, otherwise it is added at the
+    top of the section, or in a new section at the end of the file."""
+
+    current = []
+    header_line = None
+
+    for i, line in enumerate(lines):
+        stripped = line.split('#')[0].strip()
+
+        m = re.match( r'^\[(.*)\]$', stripped )
+        if m:
+            label = m.group(1)
+            if label == '':
+                current = []
+            elif label.startswith('./'):
+                current = current + [label[2:]]
+            elif label.startswith('../'):
+                current = current[:-1] + [label[3:]]
+            else:
+                current = [label]
+
+            if '/'.join(current) == section:
+                header_line = i
+            continue
+
+        m = re.match( r'^([^=\s]+)\s*=', stripped )
+        if m and '/'.join(current) == section and m.group(1) == key:
+            lines[i] = "%s = '%s'\n" % (key, value)
+            return
+
+    if header_line is not None:
+        lines.insert( header_line+1, "%s = '%s'\n" % (key, value) )
+    else:
+        lines.extend( [ '\n', '[%s]\n' % section, "%s = '%s'\n" % (key, value), '[]\n' ] )
+
+
+def get_option( lines, section, key, default ):
+    current = []
+
+    for line in lines:
+        stripped = line.split('#')[0].strip()
+
+        m = re.match( r'^\[(.*)\]$', stripped )
+        if m:
+            label = m.group(1)
+            if label == '':
+                current = []
+            elif label.startswith('./'):
+                current = current + [label[2:]]
+            elif label.startswith('../'):
+                current = current[:-1] + [label[3:]]
+            else:
+                current = [label]
+            continue
+
+        m = re.match( r'^([^=\s]+)\s*=\s*(.*)$', stripped )
+        if m and '/'.join(current) == section and m.group(1) == key:
+            return m.group(2).strip().strip('\'"')
+
+    return default
+
+
+def refinement_level( options, dim, ranks, base_ranks ):
+    """Strong scaling keeps the refinement fixed; weak scaling refines
+    so that the number of elements per rank stays roughly constant."""
+    if options.mode == 'strong':
+        return options.refine
+
+    # Each uniform refinement multiplies the number of elements by 2^dim
+    extra = math.log( float(ranks)/base_ranks, 2.0**dim )
+    return options.refine + int(round(extra))
+
+
+def prepare_run( options, case, ranks, level ):
+    executable, example_dir, input_file, dim = CASES[case]
+
+    source_dir = os.path.join( options.prefix, example_dir )
+    run_dir = os.path.join( options.workdir, '%s_%s_np%d_r%d' % (case, options.mode, ranks, level) )
+
+    if os.path.exists(run_dir):
+        shutil.rmtree(run_dir)
+    os.makedirs(run_dir)
+
+    # Meshes, chemistry files, etc. are referred to relative to the example
+    for name in os.listdir(source_dir):
+        if name != input_file and os.path.isfile( os.path.join(source_dir, name) ):
+            os.symlink( os.path.join(source_dir, name), os.path.join(run_dir, name) )
+
+    f = open( os.path.join(source_dir, input_file), 'r' )
+    lines = f.readlines()
+    f.close()
+
+    base_level = int( get_option( lines, 'mesh-options', 'uniformly_refine', '0' ) )
+    set_option( lines, 'mesh-options', 'uniformly_refine', base_level + level )
+
+    set_option( lines, 'profiling', 'enabled', 'true' )
+    set_option( lines, 'profiling', 'output_file', 'profile.json' )
+
+    if options.no_output:
+        set_option( lines, 'vis-options', 'output_vis', 'false' )
+
+    for override in options.set:
+        path, value = override.split('=', 1)
+        section, key = path.rsplit('/', 1)
+        set_option( lines, section, key, value )
+
+    f = open( os.path.join(run_dir, input_file), 'w' )
+    f.writelines(lines)
+    f.close()
+
+    return run_dir, [ os.path.join(options.prefix, executable), input_file ]
+
+
+def timer_value( timers, name ):
+    """Max over processors of a top level timer, 0 if it never ran."""
+    if name in timers and 'time_max' in timers[name]:
+        return timers[name]['time_max']
+    return 0.0
+
+
+def run_case( options, case, ranks, level ):
+    run_dir, command = prepare_run( options, case, ranks, level )
+
+    if ranks > 1 or options.mpirun_always:
+        command = shlex.split(options.mpirun) + [ str(ranks) ] + command
+
+    command += shlex.split(options.solver_options)
+
+    log = open( os.path.join(run_dir, 'run.log'), 'w' )
+
+    start = time.time()
+    status = subprocess.call( command, cwd=run_dir, stdout=log, stderr=subprocess.STDOUT )
+    total = time.time() - start
+
+    log.close()
+
+    record = { 'case': case, 'mode': options.mode, 'ranks': ranks,
+               'refine': level, 'status': status, 'total': total }
+
+    if status != 0:
+        print( 'WARNING: %s on %d ranks failed, see %s' % (case, ranks, os.path.join(run_dir, 'run.log')) )
+        return record
+
+    f = open( os.path.join(run_dir, 'profile.json'), 'r' )
+    profile = json.load(f)
+    f.close()
+
+    timers = profile['timers']
+    for phase in [ 'mesh_build', 'init', 'assembly', 'output', 'adapt' ]:
+        record[phase] = timer_value( timers, phase )
+
+    record['linear_solve'] = max( 0.0, timer_value( timers, 'solve' )
+                                  - record['assembly'] - record['output']
+                                  - record['adapt'] )
+
+    record.update( profile.get('counters', {}) )
+
+    return record
+
+
+def record_key( record ):
+    return (record['case'], record['mode'], record['ranks'], record['refine'])
+
+
+def print_table( records, baseline, tolerance ):
+    baseline_map = dict( (record_key(r), r) for r in baseline )
+
+    header = '%-22s %6s %6s %10s %10s' % ('case', 'ranks', 'refine', 'n_dofs', 'total')
+    for phase in PHASES:
+        header += ' %12s' % phase
+    header += ' %7s %7s %7s %9s' % ('newton', 'krylov', 'eff', 'baseline')
+
+    print(header)
+    print('-'*len(header))
+
+    regressions = []
+
+    # Parallel efficiency relative to the fewest ranks of each case
+    reference = {}
+    for r in sorted( records, key=lambda r: r['ranks'] ):
+        if r['status'] == 0:
+            reference.setdefault( r['case'], r )
+
+    for r in records:
+        line = '%-22s %6d %6d' % (r['case'], r['ranks'], r['refine'])
+
+        if r['status'] != 0:
+            print( line + '   FAILED' )
+            continue
+
+        line += ' %10d %10.3f' % (r.get('n_dofs', 0), r['total'])
+        for phase in PHASES:
+            line += ' %12.3f' % r[phase]
+
+        ref = reference[r['case']]
+        if r['mode'] == 'strong':
+            eff = ref['total']*ref['ranks'] / (r['total']*r['ranks'])
+        else:
+            eff = ref['total'] / r['total']
+
+        line += ' %7d %7d %7.2f' % (r.get('newton_iterations', 0), r.get('krylov_iterations', 0), eff)
+
+        base = baseline_map.get( record_key(r) )
+        if base is not None and base['status'] == 0:
+            ratio = r['total']/base['total']
+            line += ' %8.2fx' % ratio
+            if ratio > 1.0 + tolerance:
+                line += ' SLOWER'
+                regressions.append(r)
+        else:
+            line += ' %9s' % '-'
+
+        print(line)
+
+    return regressions
+
+
+def main():
+    parser = optparse.OptionParser( usage='%prog --prefix=<GRINS install prefix> [options]' )
+    parser.add_option( '--prefix', help='GRINS installation prefix containing bin/ and examples/' )
+    parser.add_option( '--cases', default=','.join(sorted(CASES.keys())),
+                       help='comma separated examples to run [%default]' )
+    parser.add_option( '--mode', default='strong', choices=['strong', 'weak'],
+                       help='strong: fixed mesh; weak: refine with the rank count [%default]' )
+    parser.add_option( '--ranks', default='1,2,4', help='comma separated MPI rank counts [%default]' )
+    parser.add_option( '--refine', type='int', default=0,
+                       help='uniform refinements added to each input (at the fewest ranks for weak) [%default]' )
+    parser.add_option( '--mpirun', default=os.environ.get('GRINS_MPIRUN', 'mpiexec -np'),
+                       help='MPI launcher, followed by the rank count [%default]' )
+    parser.add_option( '--mpirun-always', action='store_true', default=False,
+                       help='use the launcher for single rank runs as well' )
+    parser.add_option( '--solver-options', default=os.environ.get('GRINS_SOLVER_OPTIONS', ''),
+                       help='extra command line options, e.g. PETSc options' )
+    parser.add_option( '--set', action='append', default=[],
+                       help='override an input option, e.g. --set=unsteady-solver/n_timesteps=2' )
+    parser.add_option( '--no-output', action='store_true', default=False,
+                       help='turn off visualization output' )
+    parser.add_option( '--workdir', default='scaling_runs', help='directory for the runs [%default]' )
+    parser.add_option( '--output', default='scaling_results.json', help='results file [%default]' )
+    parser.add_option( '--baseline', help='results file of a previous run to compare against' )
+    parser.add_option( '--save-baseline', help='also save these results as a baseline' )
+    parser.add_option( '--tolerance', type='float', default=0.1,
+                       help='relative slowdown reported as a regression [%default]' )
+
+    (options, args) = parser.parse_args()
+
+    if options.prefix is None:
+        parser.error( 'Must specify the GRINS installation prefix with --prefix' )
+
+    cases = options.cases.split(',')
+    ranks = sorted( [ int(n) for n in options.ranks.split(',') ] )
+
+    for case in cases:
+        if case not in CASES:
+            parser.error( 'Unknown case %s; known cases are %s' % (case, ', '.join(sorted(CASES.keys()))) )
+
+    records = []
+
+    for case in cases:
+        executable = os.path.join( options.prefix, CASES[case][0] )
+        if not os.path.exists(executable):
+            print( 'WARNING: skipping %s, %s was not installed' % (case, executable) )
+            continue
+
+        for n in ranks:
+            level = refinement_level( options, CASES[case][3], n, ranks[0] )
+            print( 'Running %s on %d ranks, refinement %d' % (case, n, level) )
+            records.append( run_case( options, case, n, level ) )
+
+    baseline = []
+    if options.baseline:
+        f = open( options.baseline, 'r' )
+        baseline = json.load(f)
+        f.close()
+
+    regressions = print_table( records, baseline, options.tolerance )
+
+    for filename in [ options.output, options.save_baseline ]:
+        if filename:
+            f = open( filename, 'w' )
+            json.dump( records, f, indent=2, sort_keys=True )
+            f.close()
+
+    if regressions or any( r['status'] != 0 for r in records ):
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -127,6 +127,11 @@ namespace GRINS
 
     bool is_axisymmetric() const;
 
+    //! Whether any Neumann boundary condition is given by a function object
+    /*! NeumannFuncObj's, e.g. for GENERAL_HEAT_FLUX, may depend on the
+        solution, so the Jacobian can't be assumed constant. */
+    bool has_neumann_bound_funcs() const;
+
   protected:
 
     //! Map between boundary id and Dirichlet boundary condition type
@@ -181,6 +186,12 @@ namespace GRINS
     return _axisymmetric;
   }
 
+  inline
+  bool BCHandlingBase::has_neumann_bound_funcs() const
+  {
+    return !_neumann_bound_funcs.empty();
+  }
+
   inline
   const libMesh::Point& BCHandlingBase::get_neumann_bc_value( GRINS::BoundaryID bc_id ) const
   {
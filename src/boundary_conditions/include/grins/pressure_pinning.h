@@ -30,6 +30,9 @@
 #include "libmesh/libmesh.h"
 #include "libmesh/point.h"
 
+// C++
+#include <vector>
+
 //GRINS
 #include "grins/var_typedefs.h"
 
@@ -39,6 +42,8 @@ class Getpot;
 namespace libMesh
 {
   class DiffContext;
+  class Elem;
+  class MeshBase;
 }
 
 namespace GRINS
@@ -56,8 +61,14 @@ namespace GRINS
 		     const std::string& physics_name );
     ~PressurePinning();
 
+    //! Find the element containing the pin location
+    /*! Must be called once the mesh is set up and again after every
+        change of the mesh, before pin_value(). */
+    void locate_pin( const libMesh::MeshBase& mesh );
+
     /*! The idea here is to pin a variable to a particular value if there is
-      a null space - e.g. pressure for IncompressibleNavierStokes. */
+      a null space - e.g. pressure for IncompressibleNavierStokes. Only
+      the element found by locate_pin() is modified. */
     void pin_value( libMesh::DiffContext& context,
 		    const bool request_jacobian,
 		    const GRINS::VariableIndex var,
@@ -71,6 +82,15 @@ namespace GRINS
     //! Location we want to pin the pressure
     libMesh::Point _pin_location;
 
+    //! Whether locate_pin() has been called
+    bool _pin_located;
+
+    //! Local element containing _pin_location, NULL if not on this processor
+    const libMesh::Elem* _pin_elem;
+
+    //! Shape functions of the pinned variable at _pin_location, empty until first used
+    std::vector<libMesh::Real> _pin_phi;
+
   };
 }
 #endif //PRESSURE_PINNING_H
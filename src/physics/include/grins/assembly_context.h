@@ -26,6 +26,9 @@
 #ifndef GRINS_ASSEMBLY_CONTEXT_H
 #define GRINS_ASSEMBLY_CONTEXT_H
 
+// GRINS
+#include "grins/profiler.h"
+
 // libMesh
 #include "libmesh/fem_context.h"
 
@@ -38,10 +41,77 @@ namespace GRINS
     AssemblyContext( const libMesh::System& system );
     ~AssemblyContext();
 
+    //! Which terms of the time derivative to assemble, for IMEX time stepping
+    /*! Physics that split their element_time_derivative into explicit and
+        implicit terms (see Physics::has_explicit_terms) check
+        compute_explicit_terms() and compute_implicit_terms(). */
+    enum TermSelection{ ALL_TERMS = 0,
+                        IMPLICIT_TERMS,
+                        EXPLICIT_TERMS };
+
+    void set_term_selection( TermSelection selection );
+
+    TermSelection term_selection() const;
+
+    bool compute_explicit_terms() const;
+
+    bool compute_implicit_terms() const;
+
+    //! Timings of this context are merged into profiler on destruction
+    void set_profiler( Profiler* profiler );
+
+    //! Per-thread timings for ProfileTimer, NULL if profiling is disabled
+    ProfileBuffer* profile_buffer() const;
+
   protected:
 
+    TermSelection _term_selection;
+
+    Profiler* _profiler;
+
+    //! Filled from const cache functions too
+    mutable ProfileBuffer _profile_buffer;
+
   };
 
+  inline
+  void AssemblyContext::set_term_selection( TermSelection selection )
+  {
+    _term_selection = selection;
+    return;
+  }
+
+  inline
+  AssemblyContext::TermSelection AssemblyContext::term_selection() const
+  {
+    return _term_selection;
+  }
+
+  inline
+  bool AssemblyContext::compute_explicit_terms() const
+  {
+    return (_term_selection != IMPLICIT_TERMS);
+  }
+
+  inline
+  bool AssemblyContext::compute_implicit_terms() const
+  {
+    return (_term_selection != EXPLICIT_TERMS);
+  }
+
+  inline
+  void AssemblyContext::set_profiler( Profiler* profiler )
+  {
+    _profiler = profiler;
+    return;
+  }
+
+  inline
+  ProfileBuffer* AssemblyContext::profile_buffer() const
+  {
+    return _profiler ? &_profile_buffer : NULL;
+  }
+
 } // end namespace GRINS
 
 #endif // GRINS_ASSEMBLY_CONTEXT_H
@@ -46,6 +46,9 @@ namespace GRINS
     //! Initialize context for added physics variables
     virtual void init_context( AssemblyContext& context );
 
+    virtual void register_field_split_groups( libMesh::FEMSystem* system,
+                                              FieldSplitGroups& groups ) const;
+
   protected:
 
     SolidMechanicsFEVariables _disp_vars;
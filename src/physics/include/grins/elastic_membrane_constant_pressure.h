@@ -43,6 +43,9 @@ namespace GRINS
 
     void reset_pressure( libMesh::Real pressure_in );
 
+    //! The only parameter is "pressure"
+    virtual void set_parameter( const std::string& param_name, libMesh::Real value );
+
   private:
 
     ElasticMembraneConstantPressure();
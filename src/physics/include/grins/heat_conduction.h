@@ -50,6 +50,9 @@ namespace GRINS
     //! Initialize context for added physics variables
     virtual void init_context( AssemblyContext& context );
 
+    virtual void register_field_split_groups( libMesh::FEMSystem* system,
+                                              FieldSplitGroups& groups ) const;
+
     // residual and jacobian calculations
     // element_*, side_* as *time_derivative, *constraint, *mass_residual
 
@@ -62,6 +65,12 @@ namespace GRINS
 				AssemblyContext& context,
 				CachedValues& cache );
 
+    //! Linear, so constant for a constant conductivity and no function Neumann BCs
+    virtual bool has_constant_jacobian( bool implicit_terms_only ) const;
+
+    //! Parameters are "rho", "Cp" and, for a constant conductivity, "k"
+    virtual void set_parameter( const std::string& param_name, libMesh::Real value );
+
   protected:
 
     libMesh::Real forcing( const libMesh::Point& p );
@@ -60,6 +60,10 @@ namespace GRINS
 					  AssemblyContext& context,
 					  CachedValues& cache );
 
+    //! Convection terms are explicit in IMEX time stepping
+    virtual bool has_explicit_terms() const
+    { return true; }
+
     virtual void side_time_derivative( bool compute_jacobian,
 				       AssemblyContext& context,
 				       CachedValues& cache );
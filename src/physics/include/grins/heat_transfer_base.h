@@ -60,6 +60,12 @@ namespace GRINS
     // Context initialization
     virtual void init_context( AssemblyContext& context );
 
+    virtual void register_field_split_groups( libMesh::FEMSystem* system,
+                                              FieldSplitGroups& groups ) const;
+
+    //! Parameters are "rho", "Cp" and, for a constant conductivity, "k"
+    virtual void set_parameter( const std::string& param_name, libMesh::Real value );
+
   protected:
 
     //! Physical dimension of problem
@@ -43,7 +43,9 @@ namespace GRINS
   //! Adds generic, spatially dependent source term to HeatTransfer physics
   /*! This is templated about the source function. Any suitable source fuction can be
       used so long as its constructor takes a GetPot& and provides and operator( libMesh::Point&) and
-      grad( libMesh::Point&) methods which return Real and Gradient respectively.*/
+      grad( libMesh::Point&) methods which return Real and Gradient respectively.
+      The source "value" can be changed with set_parameter if the function is
+      constant, i.e. reset_constant_property is overloaded for it.*/
   template< class SourceFunction >
   class HeatTransferSource : public Physics
   {
@@ -63,6 +65,9 @@ namespace GRINS
 					  AssemblyContext& context,
 					  CachedValues& cache );
 
+    //! The only parameter is "value", for a constant source function
+    virtual void set_parameter( const std::string& param_name, libMesh::Real value );
+
   protected:
 
     //! Function that computes source term.
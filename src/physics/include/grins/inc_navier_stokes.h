@@ -64,11 +64,21 @@ namespace GRINS
 					  AssemblyContext& context,
 					  CachedValues& cache );
 
+    //! Convection terms are explicit in IMEX time stepping
+    virtual bool has_explicit_terms() const
+    { return true; }
+
+    //! Without convection, constant for a constant viscosity and no function Neumann BCs
+    virtual bool has_constant_jacobian( bool implicit_terms_only ) const;
+
     // Constraint part(s)
     virtual void element_constraint( bool compute_jacobian,
 				     AssemblyContext& context,
 				     CachedValues& cache );
 
+    //! Locate the pressure pin on the new mesh
+    virtual void reinit_mesh_data( const libMesh::FEMSystem& system );
+
     virtual void side_constraint( bool compute_jacobian,
                                   AssemblyContext& context,
                                   CachedValues& cache );
@@ -65,6 +65,9 @@ namespace GRINS
 				       AssemblyContext& context,
 				       CachedValues& cache );
 
+    //! Locate the pressure pin on the new mesh
+    virtual void reinit_mesh_data( const libMesh::FEMSystem& system );
+
     virtual void side_constraint( bool compute_jacobian,
                                   AssemblyContext& context,
                                   CachedValues& cache );
@@ -63,6 +63,9 @@ namespace GRINS
     // Context initialization
     virtual void init_context( AssemblyContext& context );
 
+    virtual void register_field_split_groups( libMesh::FEMSystem* system,
+                                              FieldSplitGroups& groups ) const;
+
     libMesh::Real T( const libMesh::Point& p, const AssemblyContext& c ) const;
 
     libMesh::Real rho( libMesh::Real T, libMesh::Real p0 ) const;
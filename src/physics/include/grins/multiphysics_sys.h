@@ -28,19 +28,17 @@
 
 // C++
 #include <string>
+#include <utility>
+#include <vector>
 
 // GRINS
 #include "grins_config.h"
 #include "grins/physics.h"
+#include "grins/assembly_context.h"
 
 // libMesh
 #include "libmesh/fem_system.h"
 
-#ifdef GRINS_HAVE_GRVY
-// GRVY timers
-#include "grvy.h"
-#endif
-
 // libMesh forward declartions
 class GetPot;
 
@@ -48,6 +46,7 @@ namespace libMesh
 {
   class EquationSystems;
   class DiffContext;
+  template <typename T> class LinearSolver;
 }
 
 namespace GRINS
@@ -55,6 +54,9 @@ namespace GRINS
   // Forward Declarations
   template <typename Scalar>
   class PostProcessedQuantities;
+  class Profiler;
+  class Telemetry;
+  class CompositeQoI;
 
   //! Interface with libMesh for solving Multiphysics problems.
   /*!
@@ -101,6 +103,9 @@ namespace GRINS
     //! System initialization. Calls each physics implementation of init_variables()
     virtual void init_data();
 
+    //! Collect the field-split variable groups of all physics
+    void register_field_split_groups( FieldSplitGroups& groups );
+
     //! Each Physics will register their postprocessed quantities with this call
     void register_postprocessing_vars( const GetPot& input,
                                        PostProcessedQuantities<libMesh::Real>& postprocessing );
@@ -108,6 +113,132 @@ namespace GRINS
     //! Override FEMSystem::build_context in order to use our own AssemblyContext
     virtual libMesh::AutoPtr<libMesh::DiffContext> build_context();
 
+    //! Override FEMSystem::assembly to capture the steady residual, if requested
+    virtual void assembly( bool get_residual, bool get_jacobian );
+
+    //! Override FEMSystem::reinit to reassemble a reused Jacobian on the new mesh
+    virtual void reinit();
+
+    //! Override FEMSystem::assemble_qoi to only visit elements and sides in the QoI support
+    /*! Unlike the FEMSystem sweep, the traversal is a single threaded loop;
+        it pays off when the support is a small part of the local mesh. */
+    virtual void assemble_qoi( const libMesh::QoISet& qoi_indices = libMesh::QoISet() );
+
+    //! Override FEMSystem::assemble_qoi_derivative to only visit elements and sides in the QoI support
+    /*! Single threaded, like assemble_qoi. Only used when include_liftfunc
+        is false, as in adjoint_solve; otherwise this is the FEMSystem sweep. */
+    virtual void assemble_qoi_derivative( const libMesh::QoISet& qoi_indices = libMesh::QoISet(),
+                                          bool include_liftfunc = true,
+                                          bool apply_constraints = true );
+
+    //! Override FEMSystem::adjoint_solve to solve all requested QoIs as one batch
+    /*!
+      Only if linear-nonlinear-solver/batched_adjoint_solve is set;
+      otherwise this is the libMesh implementation, which rebuilds the
+      transposed operator and its preconditioner for every QoI. In batched
+      mode the Jacobian and all the adjoint right hand sides are assembled
+      once and every adjoint shares one operator and preconditioner. With
+      PETSc, when the preconditioner can be applied transposed, the adjoints
+      are solved with KSPSolveTranspose against the Jacobian itself; if the
+      Jacobian was reused (set_reuse_jacobian()), the preconditioner of the
+      forward solves is used as is. Otherwise the transpose is formed once
+      and the preconditioner is built for the first QoI only.
+     */
+    virtual std::pair<unsigned int, libMesh::Real>
+    adjoint_solve( const libMesh::QoISet& qoi_indices = libMesh::QoISet() );
+
+    //! Whether all physics have a solution independent Jacobian
+    /*! With the IMPLICIT_TERMS selection, only the implicit terms count. */
+    bool has_constant_jacobian() const;
+
+    //! Keep the assembled Jacobian from one assembly to the next
+    /*! Only valid if has_constant_jacobian(). The matrix is reassembled
+        after the mesh, deltat, the term selection or the rate scaling
+        changed, or after invalidate_jacobian(). */
+    void set_reuse_jacobian( bool reuse );
+
+    //! Linear solver to tell to keep its preconditioner while the Jacobian is reused
+    void set_jacobian_linear_solver( libMesh::LinearSolver<libMesh::Number>* linear_solver );
+
+    //! Reassemble a reused Jacobian at the next assembly, e.g. after changing a Physics parameter
+    void invalidate_jacobian();
+
+    //! Number of assemblies that actually assembled the Jacobian
+    unsigned int n_jacobian_assemblies() const;
+
+    //! Switch time solvers, e.g. from pseudo time stepping to a steady solve
+    /*! The nonlinear solver is handed over to the new time solver, which is
+        then initialized, and the Physics are switched to steady or unsteady
+        mode to match it. On return, time_solver holds the previous time
+        solver, so swapping again restores it. */
+    void swap_time_solver( libMesh::AutoPtr<libMesh::TimeSolver>& time_solver );
+
+    //! Toggle capturing of the steady residual \f$F(u)\f$
+    /*!
+      When enabled, every residual-only assembly (which is what the nonlinear
+      solver does at each new iterate) also accumulates the *_time_derivative
+      and *_constraint contributions into the "steady_residual" vector.
+      After a solve, that vector holds \f$F(u)\f$ at the final iterate so
+      residual output does not require another assembly. Note that for
+      theta methods with theta != 1 the time derivative terms are evaluated at
+      the theta point, so the solver should only enable this when that is
+      the same as \f$F(u)\f$.
+     */
+    void set_capture_steady_residual( bool capture );
+
+    //! Whether "steady_residual" holds \f$F(u)\f$ from the most recent residual assembly
+    /*! False after any residual assembly that wasn't captured, e.g. a Jacobian
+        or IMEX assembly, and after reinit(). */
+    bool has_steady_residual() const;
+
+    libMesh::NumericVector<libMesh::Number>& get_steady_residual();
+
+    //! Toggle evaluating the QoIs during residual assemblies
+    /*!
+      When enabled, every residual-only assembly also accumulates the
+      CompositeQoI element and side contributions, reusing the FE data
+      computed for the residual, so after a solve the QoI values of the
+      final iterate are available without assemble_qoi(). As with
+      set_capture_steady_residual(), the solver should only enable this
+      when the residual is evaluated at the current solution.
+
+      This relies on libMesh::NewtonSolver assembling the residual after
+      each update. It doesn't after the last allowed iteration when
+      continue_after_max_iterations is set, so GRINS::NewtonSolver discards
+      the fused values (and the captured steady residual) when a solve
+      stops at max_nonlinear_iterations.
+     */
+    void set_fuse_qoi( bool fuse );
+
+    //! Whether the QoI values are those of the most recent residual assembly
+    /*! Only valid until the solution is changed other than by a solve. */
+    bool has_fused_qoi() const;
+
+    //! Forget the fused QoI values, e.g. when they are not at the final iterate
+    void discard_fused_qoi();
+
+    //! Forget the captured steady residual, e.g. when it is not at the final iterate
+    void discard_steady_residual();
+
+    //! Scale the time derivative \f$\dot{u}\f$ elementwise, for local time stepping
+    /*! Entry i multiplies the rate on the element with id i, so that element
+        effectively uses a time step of deltat/scaling[i]. Cleared by
+        clear_elem_rate_scaling(). The scaling is not updated under mesh
+        refinement. */
+    void set_elem_rate_scaling( const std::vector<libMesh::Real>& scaling );
+
+    void clear_elem_rate_scaling();
+
+    //! Select the terms assembled from now on, for IMEX time stepping
+    /*! With IMPLICIT_TERMS, residual assemblies add the "explicit_residual"
+        vector computed by assemble_explicit_residual(). */
+    void set_term_selection( AssemblyContext::TermSelection selection );
+
+    //! Assemble the explicit terms at the current solution into "explicit_residual"
+    /*! Only element_time_derivative of physics with explicit terms is
+        assembled. Leaves the term selection at IMPLICIT_TERMS. */
+    void assemble_explicit_residual();
+
     //! Context initialization. Calls each physics implementation of init_context()
     virtual void init_context( libMesh::DiffContext &context );
 
@@ -154,15 +285,24 @@ namespace GRINS
 
     std::tr1::shared_ptr<GRINS::Physics> get_physics( const std::string physics_name ) const;
 
+    //! All enabled physics
+    const PhysicsList& get_physics_list() const;
+
     virtual void compute_postprocessed_quantity( unsigned int quantity_index,
                                                  const AssemblyContext& context,
                                                  const libMesh::Point& point,
                                                  libMesh::Real& value );
 
-#ifdef GRINS_USE_GRVY_TIMERS
-    //! Add GRVY Timer object to system for timing physics.
-    void attach_grvy_timer( GRVY::GRVY_Timer_Class* grvy_timer );
-#endif    
+    //! Time each residual and cache function of each Physics, and the QoIs
+    /*! Must be called after the QoI is attached. Contexts built from
+        now on merge their timings into profiler when destroyed. */
+    void attach_profiler( Profiler& profiler );
+
+    //! Report each assembly to telemetry, which may be NULL
+    void set_telemetry( Telemetry* telemetry );
+
+    //! NULL unless telemetry is enabled
+    Telemetry* get_telemetry() const;
 
   private:
 
@@ -172,10 +312,93 @@ namespace GRINS
     PhysicsList _physics_list;
 
     bool _use_numerical_jacobians_only;
+
+    //! Capture steady residual during residual-only assemblies
+    bool _capture_steady_residual;
+
+    //! True only during an assembly that is capturing the steady residual
+    bool _capturing_steady_residual;
+
+    //! True while "steady_residual" holds the most recent residual assembly
+    bool _have_steady_residual;
+
+    //! Elementwise scaling of the mass term, indexed by element id. Empty if unused.
+    std::vector<libMesh::Real> _elem_rate_scaling;
+
+    //! Terms assembled by contexts built from now on
+    AssemblyContext::TermSelection _term_selection;
+
+    //! Reuse the Jacobian while it is valid
+    bool _reuse_jacobian;
+
+    //! True once the matrix holds a Jacobian that can be reused
+    bool _have_jacobian;
+
+    //! deltat the reusable Jacobian was assembled with
+    libMesh::Real _jacobian_deltat;
+
+    //! Not owned, may be NULL
+    libMesh::LinearSolver<libMesh::Number>* _jacobian_linear_solver;
+
+    unsigned int _n_jacobian_assemblies;
+
+    //! Evaluate the QoIs during residual-only assemblies
+    bool _fuse_qoi;
+
+    //! QoI being evaluated during the current assembly, NULL otherwise
+    CompositeQoI* _fusing_qoi;
+
+    //! True once the QoI values come from the most recent residual assembly
+    bool _have_fused_qoi;
+
+    //! Processor-local QoI values accumulated during the current assembly
+    std::vector<libMesh::Number> _fused_local_qoi;
+
+    //! Share the operator and preconditioner between the adjoints of all QoIs
+    bool _batched_adjoint_solve;
     
-#ifdef GRINS_USE_GRVY_TIMERS
-    GRVY::GRVY_Timer_Class* _timer;
-#endif
+    //! Not owned, NULL unless profiling
+    Profiler* _profiler;
+
+    //! Not owned, NULL unless telemetry is enabled
+    Telemetry* _telemetry;
+
+    //! Residual types, for timing
+    enum ResidualType{ ELEMENT_TIME_DERIVATIVE = 0,
+                       SIDE_TIME_DERIVATIVE,
+                       NONLOCAL_TIME_DERIVATIVE,
+                       ELEMENT_CONSTRAINT,
+                       SIDE_CONSTRAINT,
+                       NONLOCAL_CONSTRAINT,
+                       MASS_RESIDUAL,
+                       NONLOCAL_MASS_RESIDUAL,
+                       N_RESIDUAL_TYPES };
+
+    //! Profiler timers, indexed by physics then ResidualType
+    std::vector<unsigned int> _residual_timers;
+
+    //! Profiler timers of the cache functions, indexed by physics
+    std::vector<unsigned int> _cache_timers;
+
+    unsigned int _assembly_timer;
+
+    //! The attached CompositeQoI with an up to date traversal, NULL if none
+    CompositeQoI* qoi_with_traversal();
+
+    //! Add the QoI contributions of the current element interior or side, if in the support
+    void accumulate_fused_qoi( AssemblyContext& context, bool on_side );
+
+    //! Batched adjoint solves with KSPSolveTranspose on the Jacobian
+    /*! Returns false, without solving anything, unless linear_solver and
+        the matrix are PETSc objects and the preconditioner has a transpose
+        application. If set_operator is false, linear_solver must already
+        have a preconditioner set up for the current Jacobian. */
+    bool transpose_adjoint_solves( libMesh::LinearSolver<libMesh::Number>& linear_solver,
+                                   bool set_operator,
+                                   const libMesh::QoISet& qoi_indices,
+                                   double tol,
+                                   unsigned int maxits,
+                                   std::pair<unsigned int, libMesh::Real>& totalrval );
 
     // Useful typedef for refactoring
     typedef void (GRINS::Physics::*ResFuncType) (bool, AssemblyContext &, CachedValues &);
@@ -185,9 +408,53 @@ namespace GRINS
     bool _general_residual( bool request_jacobian,
 			    libMesh::DiffContext& context,
                             ResFuncType resfunc,
-                            CacheFuncType cachefunc);
+                            CacheFuncType cachefunc,
+                            ResidualType residual_type,
+                            bool is_steady_term = false );
   };
 
+  inline
+  Telemetry* MultiphysicsSystem::get_telemetry() const
+  {
+    return _telemetry;
+  }
+
+  inline
+  unsigned int MultiphysicsSystem::n_jacobian_assemblies() const
+  {
+    return _n_jacobian_assemblies;
+  }
+
+  inline
+  bool MultiphysicsSystem::has_steady_residual() const
+  {
+    return _have_steady_residual;
+  }
+
+  inline
+  bool MultiphysicsSystem::has_fused_qoi() const
+  {
+    return _have_fused_qoi;
+  }
+
+  inline
+  void MultiphysicsSystem::discard_fused_qoi()
+  {
+    _have_fused_qoi = false;
+  }
+
+  inline
+  void MultiphysicsSystem::discard_steady_residual()
+  {
+    _have_steady_residual = false;
+  }
+
+  inline
+  const PhysicsList& MultiphysicsSystem::get_physics_list() const
+  {
+    return _physics_list;
+  }
+
   inline
   std::tr1::shared_ptr<GRINS::Physics> MultiphysicsSystem::get_physics( const std::string physics_name ) const
   {
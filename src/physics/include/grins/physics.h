@@ -26,6 +26,7 @@
 #define GRINS_PHYSICS_H
 
 // C++
+#include <cstddef>
 #include <string>
 #include <set>
 
@@ -40,11 +41,6 @@
 #include "libmesh/libmesh.h"
 #include "libmesh/point.h"
 
-// GRVY
-#ifdef GRINS_HAVE_GRVY
-#include "grvy.h" // GRVY timers
-#endif
-
 // libMesh forward declarations
 class GetPot;
 namespace libMesh
@@ -62,6 +58,7 @@ namespace GRINS
   class NBCContainer;
   class DBCContainer;
   class AssemblyContext;
+  class Profiler;
 
   template <typename Scalar>
   class PostProcessedQuantities;
@@ -115,6 +112,35 @@ namespace GRINS
     //! Find if current physics is active on supplied element
     virtual bool enabled_on_elem( const libMesh::Elem* elem );
 
+    //! Relative cost of assembling this physics on one element
+    /*! Used to balance the load when repartitioning. Defaults to the
+        Physics/<physics_name>/assembly_cost_weight input, or 1. */
+    virtual libMesh::Real assembly_cost_weight() const;
+
+    //! Add the variables of this physics to named groups for field-split preconditioning
+    /*! Group names are "velocity", "pressure", "temperature", "species",
+        "turbulence" and "displacement". Variables shared between physics
+        may be added more than once. By default nothing is added; variables
+        left out of every group end up in their own block. */
+    virtual void register_field_split_groups( libMesh::FEMSystem* system,
+                                              FieldSplitGroups& groups ) const;
+
+    //! Whether element_time_derivative splits its terms for IMEX time stepping
+    /*! Physics returning true must check AssemblyContext::compute_explicit_terms()
+        and compute_implicit_terms(). Otherwise all terms are treated implicitly. */
+    virtual bool has_explicit_terms() const;
+
+    //! Whether the Jacobian contribution of this physics is independent of the solution
+    /*! That is, it depends on neither the solution nor time, so it can be
+        assembled once and reused. If implicit_terms_only, only the terms
+        assembled with AssemblyContext::IMPLICIT_TERMS are considered.
+        Defaults to false. */
+    virtual bool has_constant_jacobian( bool implicit_terms_only ) const;
+
+    //! Change a scalar model parameter, e.g. for parameter continuation
+    /*! By default, no parameters can be changed and this is an error. */
+    virtual void set_parameter( const std::string& param_name, libMesh::Real value );
+
     //! Sets whether this physics is to be solved with a steady solver or not
     /*! Since the member variable is static, only needs to be called on a single
       physics. */
@@ -132,6 +158,12 @@ namespace GRINS
     */
     virtual void set_time_evolving_vars( libMesh::FEMSystem* system );
 
+    //! Update data cached from the mesh, e.g. element lookups
+    /*! Called by MultiphysicsSystem once the system is initialized and
+        again after every change of the mesh, such as refinement or
+        repartitioning. By default, nothing is cached. */
+    virtual void reinit_mesh_data( const libMesh::FEMSystem& system );
+
     //! Register name of postprocessed quantity with PostProcessedQuantities
     /*!
       Each Physics class will need to cache an unsigned int corresponding to each
@@ -229,9 +261,16 @@ namespace GRINS
 
     ICHandlingBase* get_ic_handler(); 
 
-#ifdef GRINS_USE_GRVY_TIMERS
-    void attach_grvy_timer( GRVY::GRVY_Timer_Class* grvy_timer );
-#endif
+    //! Register timers for work inside this Physics' residuals, e.g. boundary conditions
+    /*! MultiphysicsSystem already times each residual and cache function. */
+    virtual void attach_profiler( Profiler& profiler );
+
+    //! Bytes held by this Physics, e.g. chemistry or property tables, for memory reports
+    /*! Defaults to the growth of the resident memory measured by
+        PhysicsFactory while this Physics was constructed. */
+    virtual std::size_t memory_usage() const;
+
+    void set_construction_memory( std::size_t bytes );
 
   protected:
     
@@ -254,9 +293,13 @@ namespace GRINS
 
     bool _is_axisymmetric;
 
-#ifdef GRINS_USE_GRVY_TIMERS
-    GRVY::GRVY_Timer_Class* _timer;
-#endif
+    libMesh::Real _assembly_cost_weight;
+
+    //! Resident memory growth during construction, set by PhysicsFactory
+    std::size_t _construction_memory;
+
+    //! Profiler timer for applying Neumann boundary conditions
+    unsigned int _neumann_bc_timer;
 
   private:
     Physics();
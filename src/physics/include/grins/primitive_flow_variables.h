@@ -48,6 +48,9 @@ namespace GRINS
 
     virtual void init( libMesh::FEMSystem* system );
 
+    //! Add our variables to the "velocity" and "pressure" field-split groups
+    void register_field_split_groups( libMesh::FEMSystem* system, FieldSplitGroups& groups ) const;
+
     VariableIndex u_var() const;
     VariableIndex v_var() const;
     VariableIndex w_var() const;
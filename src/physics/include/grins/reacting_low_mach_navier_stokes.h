@@ -42,6 +42,9 @@ namespace GRINS
     //! Read options from GetPot input file.
     virtual void read_input_options( const GetPot& input );
 
+    //! Also time the thermochemistry evaluations
+    virtual void attach_profiler( Profiler& profiler );
+
     //! Register postprocessing variables for ReactingLowMachNavierStokes
     virtual void register_postprocessing_vars( const GetPot& input,
                                                PostProcessedQuantities<libMesh::Real>& postprocessing );
@@ -58,6 +61,9 @@ namespace GRINS
 				       AssemblyContext& context,
 				       CachedValues& cache );
 
+    //! Locate the pressure pin on the new mesh
+    virtual void reinit_mesh_data( const libMesh::FEMSystem& system );
+
     virtual void side_constraint( bool compute_jacobian,
                                   AssemblyContext& context,
                                   CachedValues& cache );
@@ -118,6 +124,9 @@ namespace GRINS
     
     PressurePinning _p_pinning;
 
+    //! Profiler timer for the Evaluator calls in the cache functions
+    unsigned int _evaluator_timer;
+
     //! Index from registering this quantity
     unsigned int _rho_index;
 
@@ -53,8 +53,14 @@ namespace GRINS
     // Context initialization
     virtual void init_context( AssemblyContext& context );
 
+    virtual void register_field_split_groups( libMesh::FEMSystem* system,
+                                              FieldSplitGroups& groups ) const;
+
     unsigned int n_species() const;
 
+    //! Species equations and chemistry dominate, so scale with the number of species
+    virtual libMesh::Real assembly_cost_weight() const;
+
     libMesh::Real T( const libMesh::Point& p, const AssemblyContext& c ) const;
 
     void mass_fractions( const libMesh::Point& p, const AssemblyContext& c,
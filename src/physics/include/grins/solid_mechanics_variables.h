@@ -55,6 +55,9 @@ namespace GRINS
      */
     void init( libMesh::FEMSystem* system );
 
+    //! Add our variables to the "displacement" field-split group
+    void register_field_split_groups( libMesh::FEMSystem* system, FieldSplitGroups& groups ) const;
+
     bool have_v() const;
     bool have_w() const;
 
@@ -65,6 +65,12 @@ namespace GRINS
 				AssemblyContext& context,
 				CachedValues& cache );
 
+    //! Linear, so constant for a constant viscosity and no function Neumann BCs
+    virtual bool has_constant_jacobian( bool implicit_terms_only ) const;
+
+    //! Locate the pressure pin on the new mesh
+    virtual void reinit_mesh_data( const libMesh::FEMSystem& system );
+
   protected:
 
     PressurePinning _p_pinning;
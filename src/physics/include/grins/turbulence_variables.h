@@ -46,6 +46,9 @@ namespace GRINS
 
     virtual void init( libMesh::FEMSystem* system );
 
+    //! Add our variables to the "turbulence" field-split group
+    void register_field_split_groups( libMesh::FEMSystem* system, FieldSplitGroups& groups ) const;
+
     VariableIndex nu_var() const;
 
   protected:
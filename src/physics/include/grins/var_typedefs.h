@@ -28,6 +28,7 @@
 // C++
 #include <string>
 #include <map>
+#include <set>
 #include "boost/tr1/memory.hpp"
 
 // libMesh
@@ -53,5 +54,8 @@ namespace GRINS
   //! Iterator for PhysicsList
   typedef std::map< std::string,std::tr1::shared_ptr<GRINS::Physics> >::const_iterator PhysicsListIter;
 
+  //! Variables grouped into blocks for field-split preconditioning, keyed by block name
+  typedef std::map< std::string,std::set<VariableIndex> > FieldSplitGroups;
+
 }
 #endif //GRINS_VAR_TYPEDEFS_H
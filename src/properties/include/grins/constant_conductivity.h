@@ -28,6 +28,7 @@
 
 //GRINS
 #include "grins/assembly_context.h"
+#include "grins/property_types.h"
 
 // libMesh
 #include "libmesh/libmesh_common.h"
@@ -55,6 +56,8 @@ namespace GRINS
 
     libMesh::Real deriv( const libMesh::Real T ) const;
 
+    void reset_conductivity( libMesh::Real k );
+
   private:
 
     ConstantConductivity();
@@ -101,6 +104,25 @@ namespace GRINS
     return 0.0;
   }
   
+  inline
+  void ConstantConductivity::reset_conductivity( libMesh::Real k )
+  {
+    _k = k;
+  }
+
+  template<>
+  struct constant_property<ConstantConductivity>
+  {
+    static const bool value = true;
+  };
+
+  inline
+  bool reset_constant_property( ConstantConductivity& k, libMesh::Real value )
+  {
+    k.reset_conductivity( value );
+    return true;
+  }
+
 } // end namespace GRINS
 
 #endif // GRINS_CONSTANT_CONDUCTIVITY_H
@@ -26,6 +26,9 @@
 #ifndef CONSTANT_SOURCE_FUNC_H
 #define CONSTANT_SOURCE_FUNC_H
 
+// GRINS
+#include "grins/property_types.h"
+
 // libMesh
 #include "libmesh/getpot.h"
 #include "libmesh/point.h"
@@ -51,10 +54,22 @@ namespace GRINS
       return libMesh::Gradient();
     }
 
+    void reset_value( libMesh::Real value )
+    {
+      _value = value;
+    }
+
   protected:
 
     libMesh::Real _value;
 
   };
+
+  inline
+  bool reset_constant_property( ConstantSourceFunction& source, libMesh::Real value )
+  {
+    source.reset_value( value );
+    return true;
+  }
 }
 #endif //CONSTANT_SOURCE_FUNC_H
@@ -28,6 +28,7 @@
 
 //GRINS
 #include "grins/assembly_context.h"
+#include "grins/property_types.h"
 
 // libMesh
 #include "libmesh/libmesh_common.h"
@@ -53,6 +54,8 @@ namespace GRINS
 
     libMesh::Real deriv( const libMesh::Real T ) const;
 
+    void reset_viscosity( libMesh::Real mu );
+
   private:
 
     ConstantViscosity();
@@ -93,6 +96,25 @@ namespace GRINS
     return 0.0;
   }
 
+  inline
+  void ConstantViscosity::reset_viscosity( libMesh::Real mu )
+  {
+    _mu = mu;
+  }
+
+  template<>
+  struct constant_property<ConstantViscosity>
+  {
+    static const bool value = true;
+  };
+
+  inline
+  bool reset_constant_property( ConstantViscosity& mu, libMesh::Real value )
+  {
+    mu.reset_viscosity( value );
+    return true;
+  }
+
 } // end namespace GRINS
 
 #endif // GRINS_CONSTANT_VISCOSITY_H
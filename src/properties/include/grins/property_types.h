@@ -26,6 +26,9 @@
 #ifndef GRINS_PROPERTY_TYPES_H
 #define GRINS_PROPERTY_TYPES_H
 
+// libMesh
+#include "libmesh/libmesh_common.h"
+
 // These are "dummy" types to help force operator overloading
 namespace GRINS
 {
@@ -40,6 +43,24 @@ namespace GRINS
 
   template<typename Diffusivity>
   struct diffusivity_type{};
+
+  //! Whether a property is independent of the solution, space and time
+  /*! Specialized next to each constant property class. */
+  template<typename Property>
+  struct constant_property
+  {
+    static const bool value = false;
+  };
+
+  //! Change the value of a constant property, e.g. for parameter continuation
+  /*! Returns false, leaving the property alone, unless overloaded next to
+      the property class. */
+  template<typename Property>
+  inline
+  bool reset_constant_property( Property& /*property*/, libMesh::Real /*value*/ )
+  {
+    return false;
+  }
 }
 
 #endif // GRINS_PROPERTY_TYPES_H
@@ -46,6 +46,9 @@ namespace GRINS
 
     virtual bool assemble_on_sides() const;
 
+    //! Only the requested bc_ids
+    virtual bool side_support( std::set<BoundaryID>& bc_ids ) const;
+
     virtual void side_qoi( AssemblyContext& context,
                            const unsigned int qoi_index );
 
@@ -87,5 +90,12 @@ namespace GRINS
   {
     return true;
   }
+
+  inline
+  bool AverageNusseltNumber::side_support( std::set<BoundaryID>& bc_ids ) const
+  {
+    bc_ids.insert( _bc_ids.begin(), _bc_ids.end() );
+    return true;
+  }
 }
 #endif //GRINS_AVERAGE_NUSSELT_NUMBER_H
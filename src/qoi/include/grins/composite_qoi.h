@@ -26,6 +26,7 @@
 #define GRINS_COMPOSITE_QOI_H
 
 // C++
+#include <map>
 #include <vector>
 #include <ostream>
 
@@ -38,6 +39,8 @@ class GetPot;
 namespace libMesh
 {
   class DiffContext;
+  class Elem;
+  class MeshBase;
   class QoISet;
   namespace Parallel
   {
@@ -52,6 +55,7 @@ namespace GRINS
 {
   // GRINS forward declarations
   class MultiphysicsSystem;
+  class Profiler;
 
   class CompositeQoI : public libMesh::DifferentiableQoI
   {
@@ -121,10 +125,58 @@ namespace GRINS
 
     const QoIBase& get_qoi( unsigned int qoi_index ) const;
 
+    //! Time the element and side evaluations of each QoI
+    void attach_profiler( Profiler& profiler );
+
+    //! A local element visited by QoI assembly, and which parts of it
+    struct TraversalElem
+    {
+      const libMesh::Elem* elem;
+
+      //! Whether the element interior is in the support of some QoI
+      bool interior;
+
+      //! Domain boundary sides in the support of some QoI
+      std::vector<unsigned char> sides;
+    };
+
+    //! Collect the active local elements and sides in the union of the QoI supports
+    /*! See QoIBase::interior_support() and QoIBase::side_support().
+        Must be rebuilt whenever the mesh changes. */
+    void build_traversal( const libMesh::MeshBase& mesh );
+
+    //! Invalidate the traversal, e.g. after mesh refinement
+    void clear_traversal();
+
+    bool have_traversal() const;
+
+    const std::vector<TraversalElem>& traversal() const;
+
+    //! Traversal entry of an active local element, NULL if it isn't visited
+    const TraversalElem* find_traversal_elem( const libMesh::Elem& elem ) const;
+
   protected:
     
     std::vector<QoIBase*> _qois;
 
+    //! Evaluations timed by the Profiler
+    enum QoITimer{ ELEMENT_QOI = 0,
+                   ELEMENT_QOI_DERIVATIVE,
+                   SIDE_QOI,
+                   SIDE_QOI_DERIVATIVE,
+                   N_QOI_TIMERS };
+
+    //! Profiler timers indexed by QoI then QoITimer, empty unless profiling
+    std::vector<unsigned int> _qoi_timers;
+
+    //! Elements visited by MultiphysicsSystem::assemble_qoi and assemble_qoi_derivative
+    std::vector<TraversalElem> _traversal;
+
+    //! Index into _traversal of each visited element id
+    std::map<libMesh::dof_id_type,unsigned int> _traversal_index;
+
+    bool _have_traversal;
+
   };
 
   inline
@@ -133,6 +185,20 @@ namespace GRINS
     return _qois.size();
   }
 
+  inline
+  bool CompositeQoI::have_traversal() const
+  {
+    return _have_traversal;
+  }
+
+  inline
+  const std::vector<CompositeQoI::TraversalElem>& CompositeQoI::traversal() const
+  {
+    libmesh_assert( _have_traversal );
+
+    return _traversal;
+  }
+
   inline
   const QoIBase& CompositeQoI::get_qoi( unsigned int qoi_index ) const
   {
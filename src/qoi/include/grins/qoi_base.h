@@ -28,6 +28,7 @@
 
 // C++
 #include <iomanip>
+#include <set>
 
 // libMesh
 #include "libmesh/diff_qoi.h"
@@ -67,6 +68,16 @@ namespace GRINS
     /*! This is pure virtual to force to user to specify. */
     virtual bool assemble_on_sides() const =0;
 
+    //! Subdomains on which the element interior terms can be nonzero
+    /*! Return false, the default, if that can be any element. Otherwise
+        CompositeQoI only visits elements in these subdomains. */
+    virtual bool interior_support( std::set<libMesh::subdomain_id_type>& subdomain_ids ) const;
+
+    //! Boundary ids on which the side terms can be nonzero
+    /*! Return false, the default, if that can be any domain boundary side.
+        Otherwise CompositeQoI only visits sides with one of these ids. */
+    virtual bool side_support( std::set<BoundaryID>& bc_ids ) const;
+
     /*!
      * Method to allow QoI to cache any system information needed for QoI calculation,
      * for example, solution variable indices.
@@ -0,0 +1,152 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// GRINS - General Reacting Incompressible Navier-Stokes 
+//
+// Copyright (C) 2014 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_QOI_TIME_STATISTICS_H
+#define GRINS_QOI_TIME_STATISTICS_H
+
+// C++
+#include <ostream>
+#include <string>
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+
+// libMesh forward declarations
+class GetPot;
+namespace libMesh
+{
+  namespace Parallel
+  {
+    class Communicator;
+  }
+}
+
+namespace GRINS
+{
+  // GRINS forward declarations
+  class CompositeQoI;
+
+  //! Running time integrals, averages and variances of the QoIs
+  /*!
+    UnsteadySolver adds a sample of every QoI after each time step, from
+    the values already assembled (see QoI/fuse_with_residual), and
+    accumulates the trapezoidal time integrals of each QoI and of its
+    square. This replaces writing solution snapshots to compute, e.g.,
+    time averaged Nusselt numbers offline.
+
+    The state is written with each checkpoint, and read back from
+    restart-options/qoi_statistics_file, so restarted runs continue the
+    same integrals.
+
+    Options are read from the [QoI] section:
+      - time_statistics: turn the accumulation on (default false)
+      - time_statistics_start: samples before this time are ignored,
+        e.g. to skip the initial transient (default 0)
+      - time_statistics_variance: also report the variance (default false)
+      - time_statistics_output: file the final statistics are written to
+        (default none, only printed)
+   */
+  class QoITimeStatistics
+  {
+  public:
+
+    QoITimeStatistics( const GetPot& input );
+    ~QoITimeStatistics();
+
+    bool is_enabled() const;
+
+    //! Whether a sample was taken, or read from a restart file
+    bool has_samples() const;
+
+    //! Add the current values of the QoIs at the given time
+    void add_sample( libMesh::Real time, const CompositeQoI& qoi );
+
+    //! Time integral of QoI q since the first sample
+    libMesh::Real integral( unsigned int q ) const;
+
+    //! Time average of QoI q, its last value if no time has passed
+    libMesh::Real average( unsigned int q ) const;
+
+    //! Time variance of QoI q, the mean of the square minus the square of the mean
+    libMesh::Real variance( unsigned int q ) const;
+
+    //! Print the statistics of all QoIs
+    void output( std::ostream& out ) const;
+
+    //! Print to time_statistics_output, if given, on processor 0 only
+    void write_output( const libMesh::Parallel::Communicator& comm ) const;
+
+    //! Write everything needed to continue accumulating after a restart
+    void write_state( const std::string& filename ) const;
+
+    void read_state( const std::string& filename );
+
+  protected:
+
+    bool _enabled;
+
+    libMesh::Real _start_time;
+
+    bool _compute_variance;
+
+    std::string _output_file;
+
+    //! QoI names, set by the first sample and checked against later ones
+    std::vector<std::string> _names;
+
+    unsigned int _n_samples;
+
+    libMesh::Real _first_time;
+
+    libMesh::Real _last_time;
+
+    std::vector<libMesh::Real> _last_values;
+
+    std::vector<libMesh::Real> _integrals;
+
+    std::vector<libMesh::Real> _square_integrals;
+
+  private:
+
+    QoITimeStatistics();
+
+  };
+
+  inline
+  bool QoITimeStatistics::is_enabled() const
+  {
+    return _enabled;
+  }
+
+  inline
+  bool QoITimeStatistics::has_samples() const
+  {
+    return _n_samples > 0;
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_QOI_TIME_STATISTICS_H
@@ -57,6 +57,9 @@ namespace GRINS
 
     virtual bool assemble_on_sides() const;
 
+    //! Only the enabled subdomains
+    virtual bool interior_support( std::set<libMesh::subdomain_id_type>& subdomain_ids ) const;
+
     //! Initialize local variables
     /*! Any local variables that need information from libMesh get initialized
         here. For example, variable indices. */
@@ -105,5 +108,12 @@ namespace GRINS
   {
     return false;
   }
+
+  inline
+  bool Vorticity::interior_support( std::set<libMesh::subdomain_id_type>& subdomain_ids ) const
+  {
+    subdomain_ids.insert( _subdomain_ids.begin(), _subdomain_ids.end() );
+    return true;
+  }
 }
 #endif //GRINS_VORTICITY_H
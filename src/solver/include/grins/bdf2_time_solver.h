@@ -0,0 +1,134 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_BDF2_TIME_SOLVER_H
+#define GRINS_BDF2_TIME_SOLVER_H
+
+// libMesh
+#include "libmesh/unsteady_solver.h"
+
+namespace GRINS
+{
+  //! Variable step BDF2 time integrator with extrapolation based error control
+  /*!
+    Discretizes \f$M(u)\dot{u} = F(u)\f$ with the variable step BDF2
+    formula: with \f$\omega = \Delta t_n/\Delta t_{n-1}\f$,
+    \f[ \dot{u}_{n+1} \approx \frac{1}{\Delta t_n}\left( \frac{1+2\omega}{1+\omega} u_{n+1}
+        - (1+\omega) u_n + \frac{\omega^2}{1+\omega} u_{n-1} \right) \f]
+    The first step is backward Euler. The physics' mass_residual and
+    time_derivative terms are used unchanged through the solution rate in
+    the context, and the time derivative is evaluated at \f$u_{n+1}\f$.
+
+    If target_tolerance is nonzero, each step starts Newton from the
+    quadratic extrapolation of the last three solutions, and the local
+    error is estimated from the difference between the corrected and the
+    predicted solution (Milne's device, \f$\frac{2}{11}\|u-u^P\|/\|u\|\f$).
+    Steps with error above upper_tolerance (if nonzero), or with a NaN or
+    infinite error, are rejected and retried; it is an error if a retry does
+    not reduce the error or the step is rejected more than max_rejections
+    times. The next step size comes from a PI controller, limited by
+    max_growth (if nonzero). This costs one nonlinear solve per accepted
+    step.
+   */
+  class BDF2TimeSolver : public libMesh::UnsteadySolver
+  {
+  public:
+
+    BDF2TimeSolver( sys_type& s );
+
+    virtual ~BDF2TimeSolver();
+
+    virtual void init();
+
+    virtual void reinit();
+
+    virtual void solve();
+
+    //! Shift the solution history and advance time by the step just taken
+    virtual void advance_timestep();
+
+    virtual libMesh::Real error_order() const;
+
+    virtual bool element_residual( bool request_jacobian,
+                                   libMesh::DiffContext& context );
+
+    virtual bool side_residual( bool request_jacobian,
+                                libMesh::DiffContext& context );
+
+    virtual bool nonlocal_residual( bool request_jacobian,
+                                    libMesh::DiffContext& context );
+
+    //! Error tolerance targeted by the step size controller, 0 for fixed steps
+    libMesh::Real target_tolerance;
+
+    //! Steps with a larger error estimate are rejected, 0 to accept all steps
+    libMesh::Real upper_tolerance;
+
+    //! Bound on the growth of the step size, 0 for no bound
+    libMesh::Real max_growth;
+
+    //! Number of times a step may be rejected before giving up, default 10
+    unsigned int max_rejections;
+
+  protected:
+
+    typedef bool (libMesh::DifferentiablePhysics::*ResFuncType) (bool, libMesh::DiffContext&);
+
+    bool _general_residual( bool request_jacobian,
+                            libMesh::DiffContext& context,
+                            ResFuncType mass,
+                            ResFuncType time_deriv,
+                            ResFuncType constraint );
+
+    void localize_older_solution();
+
+    //! Replace the solution by the quadratic extrapolation to the new time
+    void predict_solution();
+
+    //! Relative local error estimate of the step just taken
+    libMesh::Real estimate_error();
+
+    //! Older solution, u_{n-1}, with ghosted values
+    libMesh::AutoPtr<libMesh::NumericVector<libMesh::Number> > _older_local_nonlinear_solution;
+
+    //! Size of the step just taken, t_{n+1} - t_n
+    libMesh::Real _last_deltat;
+
+    //! t_n - t_{n-1}
+    libMesh::Real _previous_deltat;
+
+    //! t_{n-1} - t_{n-2}
+    libMesh::Real _older_deltat;
+
+    //! Number of completed steps available in the history, at most 2
+    unsigned int _n_history;
+
+    //! Error estimate of the last accepted step, for the PI controller
+    libMesh::Real _last_error;
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_BDF2_TIME_SOLVER_H
@@ -0,0 +1,142 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_CHECKPOINTER_H
+#define GRINS_CHECKPOINTER_H
+
+// C++
+#include <ctime>
+#include <deque>
+#include <string>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+
+// libMesh forward declarations
+class GetPot;
+
+namespace libMesh
+{
+  class EquationSystems;
+}
+
+namespace GRINS
+{
+  // Forward declarations
+  class MultiphysicsSystem;
+  class QoITimeStatistics;
+
+  //! Periodically writes restart files from within a Solver
+  /*!
+    Each checkpoint is a directory <checkpoint_prefix>.<step> containing
+      - mesh.cpr: the current (possibly refined) mesh, already partitioned,
+        written with CheckpointIO (one file per processor for ParallelMesh),
+      - solution.xdr: all system data, including the additional vectors
+        such as the old time step solutions, written as one binary XDR
+        file per processor,
+      - mesh.xdr and solution_serial.xdr: only with
+        checkpoint_serial_solution, the same mesh in XDR format and a
+        single file copy of solution.xdr, needed to restart on a different
+        number of processors,
+      - qoi_statistics.dat: running QoI time statistics, if attached,
+      - restart.in: a GetPot snippet with the restart-options/ and
+        mesh-options/ settings needed to resume from the checkpoint
+        (time, deltat and step). It can also be read directly by
+        MeshBuilder when mesh_option = read_preprocessed_mesh.
+    Checkpoints are written every checkpoint_interval_steps steps and/or
+    every checkpoint_interval_seconds of wall-clock time; only the newest
+    n_checkpoints_kept are kept on disk.
+   */
+  class Checkpointer
+  {
+  public:
+
+    Checkpointer( const GetPot& input );
+    ~Checkpointer();
+
+    //! Whether any checkpoint interval was requested
+    bool is_enabled() const;
+
+    //! Write a checkpoint if enough steps or wall-clock time passed since the last one
+    /*! step is the index of the step the restarted run should start from. */
+    void checkpoint_if_needed( libMesh::EquationSystems& equation_system,
+                               MultiphysicsSystem& system,
+                               unsigned int step );
+
+    //! Unconditionally write a checkpoint
+    void write_checkpoint( libMesh::EquationSystems& equation_system,
+                           MultiphysicsSystem& system,
+                           unsigned int step );
+
+    //! Write the restart files into the given directory, without rotation
+    /*! This is also how a preprocessed startup directory is written. */
+    void write_restart_files( libMesh::EquationSystems& equation_system,
+                              MultiphysicsSystem& system,
+                              const std::string& dirname,
+                              unsigned int step );
+
+    //! Also checkpoint these QoI time statistics, may be NULL
+    void set_qoi_statistics( const QoITimeStatistics* statistics );
+
+  protected:
+
+    void remove_checkpoint( const std::string& dirname );
+
+    unsigned int _interval_steps;
+
+    libMesh::Real _interval_seconds;
+
+    std::string _prefix;
+
+    unsigned int _n_kept;
+
+    //! Also write a single-file solution for restarts on a different processor count
+    bool _write_serial_solution;
+
+    unsigned int _steps_since_last;
+
+    std::time_t _last_wall_time;
+
+    //! Checkpoint directories currently on disk, oldest first
+    std::deque<std::string> _checkpoints;
+
+    //! Not owned, may be NULL
+    const QoITimeStatistics* _qoi_statistics;
+
+  private:
+
+    Checkpointer();
+
+  };
+
+  inline
+  bool Checkpointer::is_enabled() const
+  {
+    return (_interval_steps > 0 || _interval_seconds > 0.0);
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_CHECKPOINTER_H
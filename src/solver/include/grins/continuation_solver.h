@@ -0,0 +1,130 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_CONTINUATION_SOLVER_H
+#define GRINS_CONTINUATION_SOLVER_H
+
+//GRINS
+#include "grins/grins_steady_solver.h"
+
+// libMesh
+#include "libmesh/id_types.h"
+
+// libMesh forward declarations
+namespace libMesh
+{
+  class DiffSolver;
+  template <typename T> class NumericVector;
+}
+
+namespace GRINS
+{
+  //! Adaptive step continuation in a scalar parameter
+  /*!
+    Generalizes DisplacementContinuationSolver. The parameter is either
+    the (constant) value of the Dirichlet boundary condition on a given
+    boundary (parameter_type = 'dirichlet'), or a parameter of a Physics
+    that implements Physics::set_parameter (parameter_type = 'physics'),
+    e.g. rho, Cp or a constant k of HeatConduction and HeatTransfer, rho or
+    a constant mu of the incompressible flow physics, or the value of a
+    constant HeatTransferSource. A parameter is changed only in the named
+    Physics; stabilization physics keep their own copy.
+
+    Each step starts Newton from a secant predictor through the last two
+    converged solutions. The step is scaled by target_iterations over
+    the number of Newton iterations taken, and halved after a failed
+    solve. With arclength = true (physics parameters only), steps after
+    the first are pseudo-arclength steps along the secant, solved with a
+    bordered Newton iteration, so that limit points in the parameter can
+    be passed.
+
+    Options are read from the [SolverOptions/Continuation] section:
+    parameter_type, boundary, physics, parameter, initial_value,
+    final_value, initial_step, min_step, max_step, target_iterations,
+    max_steps and arclength.
+   */
+  class ContinuationSolver : public SteadySolver
+  {
+  public:
+
+    ContinuationSolver( const GetPot& input );
+    virtual ~ContinuationSolver();
+
+    virtual void initialize( const GetPot& input,
+                             std::tr1::shared_ptr<libMesh::EquationSystems> equation_system,
+                             GRINS::MultiphysicsSystem* system );
+
+    virtual void solve( SolverContext& context );
+
+  protected:
+
+    enum ParameterType{ DIRICHLET_VALUE = 0,
+                        PHYSICS_PARAMETER };
+
+    void set_parameter( SolverContext& context, libMesh::Real value );
+
+    //! Newton solve at a fixed parameter value
+    bool natural_solve( SolverContext& context, libMesh::Real value,
+                        unsigned int& iterations );
+
+    //! Bordered Newton iteration for the pseudo-arclength system
+    /*! Starts from the predictor already in the solution and lambda, returns
+        the corrected parameter value in lambda. */
+    bool arclength_solve( SolverContext& context,
+                          const libMesh::NumericVector<libMesh::Number>& u_last,
+                          libMesh::Real lambda_last,
+                          const libMesh::NumericVector<libMesh::Number>& tangent_u,
+                          libMesh::Real tangent_lambda,
+                          libMesh::Real ds,
+                          libMesh::Real& lambda,
+                          unsigned int& iterations );
+
+    bool solve_converged( const libMesh::DiffSolver& diff_solver ) const;
+
+    ParameterType _parameter_type;
+
+    //! Boundary whose Dirichlet value is the parameter
+    libMesh::boundary_id_type _bc_id;
+
+    //! Cache index into libMesh::DirichletBoundaries
+    unsigned int _bc_index;
+
+    std::string _physics_name;
+    std::string _parameter_name;
+
+    libMesh::Real _initial_value;
+    libMesh::Real _final_value;
+    libMesh::Real _initial_step;
+    libMesh::Real _min_step;
+    libMesh::Real _max_step;
+
+    unsigned int _target_iterations;
+    unsigned int _max_steps;
+
+    bool _arclength;
+
+  };
+} // namespace GRINS
+#endif // GRINS_CONTINUATION_SOLVER_H
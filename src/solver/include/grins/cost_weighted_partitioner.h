@@ -0,0 +1,84 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_COST_WEIGHTED_PARTITIONER_H
+#define GRINS_COST_WEIGHTED_PARTITIONER_H
+
+// C++
+#include <map>
+
+// GRINS
+#include "grins/var_typedefs.h"
+
+// libMesh
+#include "libmesh/partitioner.h"
+#include "libmesh/id_types.h"
+
+namespace GRINS
+{
+  //! Partition active elements by estimated assembly cost
+  /*!
+    Active elements are ordered along a Morton space-filling curve through
+    their centroids and the curve is cut into pieces of equal total weight.
+    The weight of an element is the sum of Physics::assembly_cost_weight()
+    over the physics enabled on it, scaled by an optional per-subdomain
+    weight. Since refined elements each count separately, this also
+    balances regions that were refined heavily.
+
+    Only replicated (serial) meshes are supported: every processor
+    computes the same partition from the full mesh.
+   */
+  class CostWeightedPartitioner : public libMesh::Partitioner
+  {
+  public:
+
+    CostWeightedPartitioner( const PhysicsList& physics_list );
+    virtual ~CostWeightedPartitioner();
+
+    virtual libMesh::AutoPtr<libMesh::Partitioner> clone() const;
+
+    //! Scale the weight of all elements in the subdomain
+    void set_subdomain_weight( libMesh::subdomain_id_type subdomain_id, libMesh::Real weight );
+
+    //! Estimated assembly cost of the element
+    libMesh::Real elem_weight( const libMesh::Elem* elem ) const;
+
+  protected:
+
+    virtual void _do_partition( libMesh::MeshBase& mesh, const unsigned int n );
+
+    PhysicsList _physics_list;
+
+    std::map<libMesh::subdomain_id_type,libMesh::Real> _subdomain_weights;
+
+  private:
+
+    CostWeightedPartitioner();
+
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_COST_WEIGHTED_PARTITIONER_H
@@ -0,0 +1,110 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_FIELD_SPLIT_PRECONDITIONER_H
+#define GRINS_FIELD_SPLIT_PRECONDITIONER_H
+
+// C++
+#include <string>
+#include <vector>
+
+// GRINS
+#include "grins/var_typedefs.h"
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+
+// libMesh forward declarations
+class GetPot;
+
+namespace libMesh
+{
+  template <typename T> class LinearSolver;
+}
+
+namespace GRINS
+{
+  // Forward declarations
+  class MultiphysicsSystem;
+
+  //! PETSc field-split preconditioning built from the Physics variable groups
+  /*!
+    Each Physics adds its variables to named groups (see
+    Physics::register_field_split_groups()); the groups are turned into
+    PETSc index sets, one per split, so no index sets need to be built
+    by hand. linear-nonlinear-solver/field_split_preset selects the splits
+    and the default PETSc options:
+      - none: (default) the linear solver is left alone.
+      - schur: two splits, "pressure" and "velocity" (which also holds
+        every non-pressure variable), combined with a lower triangular
+        Schur complement factorization, using the selfp approximation of
+        the Schur complement and algebraic multigrid for both blocks.
+    Variables in no group also go into the "velocity" split. Only options
+    not given on the command line are set, so any of them can be
+    overridden with the usual -fieldsplit_<split>_ prefixed PETSc options.
+   */
+  class FieldSplitPreconditioner
+  {
+  public:
+
+    FieldSplitPreconditioner( const GetPot& input );
+    ~FieldSplitPreconditioner();
+
+    bool is_enabled() const;
+
+    //! Set the PETSc options and field-split index sets of linear_solver
+    /*! Must be called again whenever the linear solver was cleared,
+        e.g. after mesh refinement. */
+    void setup( MultiphysicsSystem& system,
+                libMesh::LinearSolver<libMesh::Number>& linear_solver ) const;
+
+  protected:
+
+    enum Preset { NONE = 0, SCHUR };
+
+    //! Split names and the variables in each split, for the current preset
+    void build_splits( MultiphysicsSystem& system,
+                       std::vector<std::string>& split_names,
+                       std::vector<std::set<VariableIndex> >& split_vars ) const;
+
+    void set_petsc_options( const std::vector<std::string>& split_names ) const;
+
+    Preset _preset;
+
+  private:
+
+    FieldSplitPreconditioner();
+
+  };
+
+  inline
+  bool FieldSplitPreconditioner::is_enabled() const
+  {
+    return _preset != NONE;
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_FIELD_SPLIT_PRECONDITIONER_H
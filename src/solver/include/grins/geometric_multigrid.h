@@ -0,0 +1,142 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_GEOMETRIC_MULTIGRID_H
+#define GRINS_GEOMETRIC_MULTIGRID_H
+
+// C++
+#include <map>
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+
+// libMesh forward declarations
+class GetPot;
+
+namespace libMesh
+{
+  class Elem;
+  template <typename T> class LinearSolver;
+}
+
+namespace GRINS
+{
+  // Forward declarations
+  class MultiphysicsSystem;
+
+  //! PETSc multigrid preconditioner on the mesh refinement hierarchy
+  /*!
+    The refinement levels of the mesh, from uniform or local refinement in
+    MeshBuilder or from the mesh adaptive solvers, are used as the grid
+    hierarchy. Level k is made of the elements of refinement level k and
+    the active elements of lower levels, so the finest level is the active
+    mesh. The prolongation from level k-1 to level k evaluates the parent
+    shape functions at the nodes of its children, so only LAGRANGE (and
+    SCALAR) variables are supported. Coarse operators are Galerkin
+    products \f$P^T A P\f$ of the assembled Jacobian.
+
+    Options, in linear-nonlinear-solver/:
+      - geometric_multigrid: enable (default false)
+      - geometric_multigrid_max_levels: maximum number of levels, counted
+        from the finest (default 0, i.e. all of them)
+    The default smoother depends on the physics: Richardson with additive
+    Schwarz/ILU for systems with a pressure (saddle point problems) and
+    Chebyshev/SOR otherwise; the coarsest level is solved redundantly
+    with LU. Any -mg_ PETSc option given by the user takes precedence.
+
+    The interpolation is built from the full element hierarchy on each
+    processor, so the mesh must be serial.
+   */
+  class GeometricMultigrid
+  {
+  public:
+
+    GeometricMultigrid( const GetPot& input );
+    ~GeometricMultigrid();
+
+    bool is_enabled() const;
+
+    //! Set the PETSc options, levels and interpolation operators of linear_solver
+    /*! Must be called again whenever the mesh changed. */
+    void setup( MultiphysicsSystem& system,
+                libMesh::LinearSolver<libMesh::Number>& linear_solver ) const;
+
+  protected:
+
+    //! Global index of each (node id, variable) dof on one level
+    typedef std::map<std::pair<libMesh::dof_id_type,unsigned int>,libMesh::dof_id_type> LevelDofMap;
+
+    //! Interpolation weights for each row of a prolongation matrix
+    typedef std::map<libMesh::dof_id_type,std::map<libMesh::dof_id_type,libMesh::Real> > InterpolationRows;
+
+    //! Whether elem is part of the mesh of refinement level "level"
+    bool in_level( const libMesh::Elem& elem, unsigned int level ) const;
+
+    //! Number the dofs of a coarse level, contiguously by processor
+    /*! SCALAR dofs go to the last processor, as in libMesh. */
+    void number_level_dofs( const MultiphysicsSystem& system,
+                            unsigned int level,
+                            LevelDofMap& dofs,
+                            std::vector<libMesh::dof_id_type>& scalar_dofs,
+                            std::vector<libMesh::dof_id_type>& n_local_dofs ) const;
+
+    //! Use the DofMap numbering for the finest level
+    void number_finest_dofs( const MultiphysicsSystem& system,
+                             LevelDofMap& dofs,
+                             std::vector<libMesh::dof_id_type>& scalar_dofs,
+                             std::vector<libMesh::dof_id_type>& n_local_dofs ) const;
+
+    //! Interpolation from level-1 to level
+    void build_interpolation( const MultiphysicsSystem& system,
+                              unsigned int level,
+                              const LevelDofMap& coarse_dofs,
+                              const std::vector<libMesh::dof_id_type>& coarse_scalar_dofs,
+                              const LevelDofMap& fine_dofs,
+                              const std::vector<libMesh::dof_id_type>& fine_scalar_dofs,
+                              InterpolationRows& rows ) const;
+
+    void set_petsc_options( MultiphysicsSystem& system ) const;
+
+    bool _enabled;
+
+    unsigned int _max_levels;
+
+  private:
+
+    GeometricMultigrid();
+
+  };
+
+  inline
+  bool GeometricMultigrid::is_enabled() const
+  {
+    return _enabled;
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_GEOMETRIC_MULTIGRID_H
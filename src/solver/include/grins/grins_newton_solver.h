@@ -0,0 +1,103 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_NEWTON_SOLVER_H
+#define GRINS_NEWTON_SOLVER_H
+
+// GRINS
+#include "grins/field_split_preconditioner.h"
+#include "grins/geometric_multigrid.h"
+
+// libMesh
+#include "libmesh/newton_solver.h"
+
+// libMesh forward declarations
+class GetPot;
+
+namespace GRINS
+{
+  //! libMesh::NewtonSolver with GRINS specific linear solver setup
+  /*!
+    - For systems where MultiphysicsSystem::has_constant_jacobian() holds,
+      the MultiphysicsSystem only assembles the Jacobian when it changes.
+      This solver hands its linear solver to the MultiphysicsSystem, which
+      then also tells it to reuse the preconditioner (e.g. a direct
+      factorization) whenever the matrix was not reassembled.
+    - If a field-split preset is requested, the field-split index sets are
+      built from the Physics variable groups before the first solve, and
+      again after each reinit().
+    - If geometric multigrid is requested, the interpolation operators
+      are built from the mesh refinement hierarchy in the same way.
+   */
+  class NewtonSolver : public libMesh::NewtonSolver
+  {
+  public:
+
+    NewtonSolver( sys_type& system, const GetPot& input );
+
+    virtual ~NewtonSolver();
+
+    //! The linear solver is rebuilt, so the preconditioner must be set up again
+    virtual void reinit();
+
+    virtual unsigned int solve();
+
+    //! Newton iterations summed over all solves
+    /*! total_outer_iterations() only counts the last solve. */
+    unsigned int accumulated_outer_iterations() const;
+
+    //! Krylov iterations summed over all solves
+    unsigned int accumulated_inner_iterations() const;
+
+  protected:
+
+    FieldSplitPreconditioner _field_split;
+
+    GeometricMultigrid _multigrid;
+
+    //! Whether the current linear solver has its field-split or multigrid setup
+    bool _preconditioner_ready;
+
+    unsigned int _accumulated_outer_iterations;
+
+    unsigned int _accumulated_inner_iterations;
+
+  };
+
+  inline
+  unsigned int NewtonSolver::accumulated_outer_iterations() const
+  {
+    return _accumulated_outer_iterations;
+  }
+
+  inline
+  unsigned int NewtonSolver::accumulated_inner_iterations() const
+  {
+    return _accumulated_inner_iterations;
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_NEWTON_SOLVER_H
@@ -31,14 +31,11 @@
 
 // GRINS
 #include "grins/nbc_container.h"
+#include "grins/checkpointer.h"
 
 // libMesh
 #include "libmesh/equation_systems.h"
 
-#ifdef GRINS_HAVE_GRVY
-#include "grvy.h" // GRVY timers
-#endif
-
 // libMesh forward declarations
 class GetPot;
 
@@ -78,6 +75,9 @@ namespace GRINS
     unsigned int _max_linear_iterations;
     bool _continue_after_backtrack_failure;
 
+    //! Reuse the Jacobian and preconditioner when MultiphysicsSystem::has_constant_jacobian()
+    bool _reuse_constant_jacobian;
+
     // Screen display options
     bool _solver_quiet;
     bool _solver_verbose;    
@@ -87,6 +87,9 @@ namespace GRINS
        for example parameter continuation. */
     std::map< std::string, GRINS::NBCContainer > _neumann_bc_funcs;
 
+    //! Periodic restart file output, configured in restart-options/
+    Checkpointer _checkpointer;
+
     void set_solver_options( libMesh::DiffSolver& solver );
 
     virtual void init_time_solver(GRINS::MultiphysicsSystem* system)=0;
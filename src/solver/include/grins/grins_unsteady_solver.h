@@ -28,13 +28,14 @@
 
 //GRINS
 #include "grins/grins_solver.h"
+#include "grins/qoi_time_statistics.h"
 
 //libMesh
 #include "libmesh/system_norm.h"
 
 namespace GRINS
 {
-  class UnsteadySolver : public Solver
+  class UnsteadySolver : public virtual Solver
   {
   public:
 
@@ -47,16 +48,57 @@ namespace GRINS
 
     virtual void init_time_solver(GRINS::MultiphysicsSystem* system);
 
+    //! Store the current solution and replace it by the extrapolated initial guess
+    /*! The history vectors are added to the system (and projected under mesh
+        refinement). Does nothing until enough history is available. */
+    void predict_solution( GRINS::MultiphysicsSystem& system );
+
+    //! Forget the solution history, e.g. after a rejected time step
+    void reset_predictor();
+
+    std::string predictor_vector_name( unsigned int k ) const;
+
+    //! Add the QoI values of the current solution to the time statistics
+    /*! Uses the values fused into the solve if available. */
+    void sample_qoi_statistics( SolverContext& context );
+
+    //! Called after each time step is advanced, before checkpointing
+    /*! Does nothing by default. Subclasses can change the mesh here;
+        a checkpoint written afterwards restarts from the changed state. */
+    virtual void end_timestep( SolverContext& context, unsigned int t_step );
+
     unsigned int _n_timesteps;
+
+    //! First time step index, nonzero when restarting from a checkpoint
+    unsigned int _first_timestep;
     unsigned int _backtrack_deltat;
     double _theta;
     double _deltat;
 
+    //! Use the variable step BDF2 integrator instead of the theta method
+    bool _use_bdf2;
+
+    //! Use IMEXEulerSolver: explicit convection, backward Euler for the rest
+    bool _use_imex;
+
     // Options for adaptive time solvers
     double _target_tolerance;
     double _upper_tolerance;
     double _max_growth;
     libMesh::SystemNorm _component_norm;
+
+    //! Order of the solution extrapolation used as initial Newton guess
+    /*! 0 = none (previous solution), 1 = linear, 2 = quadratic */
+    unsigned int _predictor_order;
+
+    //! Number of valid history vectors
+    unsigned int _n_predictor_history;
+
+    //! Times of the history vectors, newest first
+    std::vector<libMesh::Real> _predictor_times;
+
+    //! Time integrals and averages of the QoIs
+    QoITimeStatistics _qoi_statistics;
   };
 
 } // end namespace GRINS
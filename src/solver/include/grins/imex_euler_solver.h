@@ -0,0 +1,63 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_IMEX_EULER_SOLVER_H
+#define GRINS_IMEX_EULER_SOLVER_H
+
+// libMesh
+#include "libmesh/euler_solver.h"
+
+namespace GRINS
+{
+  //! First order implicit-explicit (IMEX) Euler time integrator
+  /*!
+    Backward Euler, except that the terms a Physics marks as explicit
+    (see Physics::has_explicit_terms(), currently the convection terms of
+    IncompressibleNavierStokes and HeatTransfer) are evaluated once per step
+    at the old solution. The Newton solve of each step then only sees the
+    implicit terms, so for convection dominated flows with a constant
+    viscosity/conductivity the Jacobian is a Stokes-like operator that does
+    not change from one Newton iteration (or step) to the next.
+
+    The explicit terms are stored in the MultiphysicsSystem "explicit_residual"
+    vector, which MultiphysicsSystem::assembly adds to every residual
+    assembled with the IMPLICIT_TERMS selection.
+   */
+  class IMEXEulerSolver : public libMesh::EulerSolver
+  {
+  public:
+
+    IMEXEulerSolver( sys_type& s );
+
+    virtual ~IMEXEulerSolver();
+
+    //! Assemble the explicit terms at the old solution, then solve for the new one
+    virtual void solve();
+
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_IMEX_EULER_SOLVER_H
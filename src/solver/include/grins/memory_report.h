@@ -0,0 +1,140 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_MEMORY_REPORT_H
+#define GRINS_MEMORY_REPORT_H
+
+// C++
+#include <cstddef>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+
+// libMesh forward declarations
+class GetPot;
+
+namespace libMesh
+{
+  class EquationSystems;
+  class MeshBase;
+  class System;
+  class DofMap;
+  template <typename T> class NumericVector;
+}
+
+namespace GRINS
+{
+  //! Per-subsystem memory accounting, printed at selected points of a run
+  /*!
+    Each subsystem is queried for the memory it holds on this processor:
+      - mesh: elements and nodes stored on this processor (including
+        ghosts), with their connectivity and dof indexing, and boundary
+        conditions,
+      - <system>/dof_map: constraint rows, send list and sparsity pattern,
+      - <system>/matrix: the system matrix,
+      - <system>/vectors, <system>/adjoint_vectors: solution, residual and
+        additional vectors. This covers every system in the
+        EquationSystems, e.g. interior_output (postprocessed quantities)
+        and distance_function (SpalartAllmaras),
+      - physics/<name>: Physics::memory_usage(), which by default is the
+        growth of the resident set size while the Physics was constructed;
+        this is where chemistry mixtures and their tables show up.
+    The accounted total is compared with the measured resident set size;
+    the difference ("unaccounted") is libMesh/PETSc/MPI overhead, heap
+    fragmentation and anything not listed above. Only the PETSc matrix
+    size is exact; everything else is an estimate from the stored sizes.
+
+    Processor 0 prints the minimum, maximum (and where it is attained)
+    and total over processors of each entry. The options are read from
+    screen-options:
+      - print_memory_report: turn the report on (default false)
+      - memory_report_points: any of init, amr (after each mesh
+        refinement) and exit (default all three)
+      - memory_report_per_rank: also print the accounted and resident
+        memory of each processor (default false)
+   */
+  class MemoryReport
+  {
+  public:
+
+    MemoryReport( const GetPot& input );
+    ~MemoryReport();
+
+    bool is_enabled() const;
+
+    //! Whether a report was requested at the given point: init, amr or exit
+    bool is_requested( const std::string& point ) const;
+
+    //! Print the report if it was requested at this point
+    /*! This is collective: it must be called on all processors. */
+    void report( const std::string& point,
+                 const libMesh::EquationSystems& equation_system ) const;
+
+  protected:
+
+    typedef std::vector<std::pair<std::string,std::size_t> > Entries;
+
+    void add_mesh_entries( const libMesh::MeshBase& mesh, Entries& entries ) const;
+
+    void add_system_entries( const libMesh::System& system, Entries& entries ) const;
+
+    void add_physics_entries( const libMesh::EquationSystems& equation_system,
+                              Entries& entries ) const;
+
+    //! Local storage of a vector: ghosted vectors also hold the send list
+    std::size_t vector_memory( const libMesh::NumericVector<libMesh::Number>& vec,
+                               const libMesh::DofMap& dof_map ) const;
+
+    bool _enabled;
+
+    std::set<std::string> _points;
+
+    bool _per_rank;
+
+  private:
+
+    MemoryReport();
+
+  };
+
+  inline
+  bool MemoryReport::is_enabled() const
+  {
+    return _enabled;
+  }
+
+  inline
+  bool MemoryReport::is_requested( const std::string& point ) const
+  {
+    return _enabled && _points.count(point);
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_MEMORY_REPORT_H
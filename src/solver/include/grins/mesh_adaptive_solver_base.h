@@ -26,6 +26,7 @@
 #define GRINS_MESH_ADAPTIVE_SOLVER_BASE_H
 
 // C++
+#include <map>
 #include <string>
 
 // Boost
@@ -37,6 +38,7 @@
 //libMesh
 #include "libmesh/libmesh.h"
 #include "libmesh/mesh_refinement.h"
+#include "libmesh/id_types.h"
 
 // libMesh forward declarations
 class GetPot;
@@ -44,11 +46,14 @@ namespace libMesh
 {
   class MeshBase;
   class ErrorVector;
+  class DiffSolver;
 }
 
 namespace GRINS
 {
-  class MeshAdaptiveSolverBase : public Solver
+  class MultiphysicsSystem;
+
+  class MeshAdaptiveSolverBase : public virtual Solver
   {
   public:
 
@@ -83,19 +88,45 @@ namespace GRINS
 
     bool _do_adjoint_solve;
 
+    //! Rebalance by estimated assembly cost when the mesh changes
+    bool _cost_weighted_repartition;
+
+    //! Optional per-subdomain scaling of the element costs
+    std::map<libMesh::subdomain_id_type,libMesh::Real> _subdomain_cost_weights;
+
+    //! Solve early (discarded) refinement cycles to looser tolerances
+    bool _inexact_solves;
+    libMesh::Real _loose_relative_residual_tolerance;
+    libMesh::Real _loose_linear_tolerance;
+
     RefinementFlaggingType _refinement_type;
 
     boost::scoped_ptr<libMesh::MeshRefinement> _mesh_refinement;
 
     void build_mesh_refinement( libMesh::MeshBase& mesh );
 
+    //! Install a CostWeightedPartitioner on the mesh, if requested
+    /*! Meshes are repartitioned after each refinement, so this must be
+        called before refining. */
+    void build_partitioner( libMesh::MeshBase& mesh, const MultiphysicsSystem& system );
+
     void set_refinement_type( const GetPot& input,
                               RefinementFlaggingType& refinement_type );
 
     bool check_for_adjoint_solve( const GetPot& input ) const;
 
+    libMesh::Real global_error_estimate( const libMesh::ErrorVector& error ) const;
+
     bool check_for_convergence( const libMesh::ErrorVector& error ) const;
 
+    //! How close to the full solver tolerances to solve this cycle, in [0,1]
+    /*! 1 on the last cycle. error_estimate is that of the previous cycle,
+        or 0 if there is none yet. */
+    libMesh::Real solve_tightness( unsigned int r_step, libMesh::Real error_estimate ) const;
+
+    //! Interpolate between the loose and the full solver tolerances
+    void set_solve_tightness( libMesh::DiffSolver& solver, libMesh::Real tightness );
+
     void flag_elements_for_refinement( const libMesh::ErrorVector& error );
 
   private:
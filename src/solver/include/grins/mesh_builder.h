@@ -65,6 +65,17 @@ namespace GRINS
                                         const libMesh::Parallel::Communicator &comm,
                                         libMesh::UnstructuredMesh& mesh ) const;
 
+    //! Read a mesh from a checkpoint/preprocessed startup directory
+    /*! If the directory was written on the same number of processors
+        with the same kind of mesh, each processor reads its part of the
+        already partitioned mesh and no repartitioning is done. Otherwise,
+        the serial XDR copy is read and partitioned as usual; it is only
+        written with restart-options/checkpoint_serial_solution. In both
+        cases the mesh is already refined. */
+    void read_preprocessed_mesh( const std::string& dirname,
+                                 const libMesh::Parallel::Communicator &comm,
+                                 libMesh::UnstructuredMesh& mesh ) const;
+
   };
 
 } // end namespace block
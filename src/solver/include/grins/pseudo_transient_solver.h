@@ -0,0 +1,88 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_PSEUDO_TRANSIENT_SOLVER_H
+#define GRINS_PSEUDO_TRANSIENT_SOLVER_H
+
+//GRINS
+#include "grins/grins_solver.h"
+
+namespace GRINS
+{
+  //! Steady solver using pseudo-transient continuation
+  /*!
+    Takes backward Euler steps in pseudo time towards the steady state,
+    using the physics' mass_residual terms. Each element uses a local
+    pseudo time step deltat*(h_elem/h_min)^local_deltat_exponent, and the
+    global deltat grows as the steady residual drops (switched evolution
+    relaxation): deltat_{k+1} = deltat_k*(|F_{k-1}|/|F_k|)^ser_exponent.
+    Once the steady residual has dropped by switch_tolerance (or after
+    max_pseudo_steps), the time solver is swapped for a steady solver and a
+    final Newton solve is done on the steady equations. The pseudo time
+    solver and the unsteady Physics mode are restored afterwards.
+
+    Options are read from the [pseudo-transient-solver] section:
+      - initial_deltat (default 1.e-3)
+      - max_deltat (default 1.e+10)
+      - local_deltat_exponent (default 1, 0 for a uniform pseudo time step)
+      - ser_exponent (default 1)
+      - max_growth: bound on the growth of deltat per step (default 10)
+      - max_pseudo_steps (default 200)
+      - switch_tolerance: relative steady residual drop (default 1.e-4)
+      - backtrack_deltat: number of times deltat may be halved after a
+        failed pseudo time step (default 5)
+   */
+  class PseudoTransientSolver : public Solver
+  {
+  public:
+
+    PseudoTransientSolver( const GetPot& input );
+    virtual ~PseudoTransientSolver();
+
+    virtual void solve( SolverContext& context );
+
+  protected:
+
+    virtual void init_time_solver( GRINS::MultiphysicsSystem* system );
+
+    //! Compute the mass term scaling (h_min/h_elem)^p for each element
+    void compute_local_scaling( GRINS::MultiphysicsSystem& system );
+
+    //! Norm of the steady residual F(u) captured from the last residual assembly
+    libMesh::Real steady_residual_norm( GRINS::MultiphysicsSystem& system );
+
+    libMesh::Real _initial_deltat;
+    libMesh::Real _max_deltat;
+    libMesh::Real _local_deltat_exponent;
+    libMesh::Real _ser_exponent;
+    libMesh::Real _max_growth;
+    unsigned int _max_pseudo_steps;
+    libMesh::Real _switch_tolerance;
+    unsigned int _backtrack_deltat;
+
+  };
+
+} // end namespace GRINS
+#endif // GRINS_PSEUDO_TRANSIENT_SOLVER_H
@@ -38,6 +38,11 @@
 #include "grins/nbc_container.h"
 #include "grins/dbc_container.h"
 #include "grins/postprocessed_quantities.h"
+#include "grins/monitor.h"
+#include "grins/checkpointer.h"
+#include "grins/profiler.h"
+#include "grins/telemetry.h"
+#include "grins/memory_report.h"
 
 // libMesh
 #include "libmesh/error_estimator.h"
@@ -78,6 +83,7 @@ namespace GRINS
     libMesh::Number get_qoi_value( unsigned int qoi_index ) const;
 
 #ifdef GRINS_USE_GRVY_TIMERS
+    //! Deprecated: Physics are now timed by the Profiler (profiling/enabled)
     void attach_grvy_timer( GRVY::GRVY_Timer_Class* grvy_timer );
 #endif
 
@@ -91,6 +97,15 @@ namespace GRINS
     void attach_dirichlet_bc_funcs( std::multimap< GRINS::PhysicsName, GRINS::DBCContainer > dbc_map,
 				    GRINS::MultiphysicsSystem* system );
 
+    //! Builds the mesh under the "mesh_build" timer
+    std::tr1::shared_ptr<libMesh::UnstructuredMesh> build_mesh( const GetPot& input,
+                                                               SimulationBuilder& sim_builder,
+                                                               const libMesh::Parallel::Communicator &comm );
+
+    //! Mesh, init, assembly, QoI, solve and output timers, reported at the end of run()
+    /*! Declared first so that it exists while the mesh is built. */
+    std::tr1::shared_ptr<Profiler> _profiler;
+
     std::tr1::shared_ptr<libMesh::UnstructuredMesh> _mesh;
 
     std::tr1::shared_ptr<libMesh::EquationSystems> _equation_system;
@@ -114,6 +129,9 @@ namespace GRINS
     bool _print_qoi;
     bool _print_scalars;
 
+    //! Evaluate the QoIs during the residual assemblies of the solve
+    bool _fuse_qoi;
+
     // Visualization options
     bool _output_vis;
     bool _output_residual;
@@ -122,6 +140,17 @@ namespace GRINS
 
     std::tr1::shared_ptr<libMesh::ErrorEstimator> _error_estimator;
 
+    std::tr1::shared_ptr<Monitor> _monitor;
+
+    //! Structured per-step/per-Newton solver records
+    std::tr1::shared_ptr<Telemetry> _telemetry;
+
+    //! Per-subsystem memory accounting at init, after AMR and at exit
+    std::tr1::shared_ptr<MemoryReport> _memory_report;
+
+    //! Stop after setup, e.g. once a preprocessed startup directory is written
+    bool _preprocess_only;
+
   private:
 
     Simulation();
@@ -31,6 +31,10 @@
 // GRINS
 #include "grins/visualization.h"
 #include "grins/postprocessed_quantities.h"
+#include "grins/monitor.h"
+#include "grins/telemetry.h"
+#include "grins/memory_report.h"
+#include "grins/profiler.h"
 
 // libMesh
 #include "libmesh/error_estimator.h"
@@ -61,10 +65,27 @@ namespace GRINS
     bool output_residual;
     bool print_scalars;
 
+    //! Evaluate the QoIs during the residual assemblies, where the solver allows it
+    bool fuse_qoi;
+
     std::tr1::shared_ptr<PostProcessedQuantities<libMesh::Real> > postprocessing;
 
     std::tr1::shared_ptr<libMesh::ErrorEstimator> error_estimator;
 
+    std::tr1::shared_ptr<Monitor> monitor;
+
+    //! NULL unless telemetry is enabled
+    std::tr1::shared_ptr<Telemetry> telemetry;
+
+    //! NULL unless a memory report was requested after each mesh refinement
+    std::tr1::shared_ptr<MemoryReport> memory_report;
+
+    //! Profiler buffer for code outside of assembly, NULL if profiling is disabled
+    ProfileBuffer* profile_buffer;
+
+    //! Profiler timer for error estimation and mesh refinement
+    unsigned int adapt_timer;
+
   };
 
 } // end namespace GRINS
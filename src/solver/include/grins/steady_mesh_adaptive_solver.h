@@ -48,6 +48,9 @@ namespace GRINS
 
     virtual void init_time_solver( MultiphysicsSystem* system );
 
+    //! First refinement step index, nonzero when restarting from a checkpoint
+    unsigned int _first_refinement_step;
+
   };
 
 } // end namespace GRINS
@@ -0,0 +1,200 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_TELEMETRY_H
+#define GRINS_TELEMETRY_H
+
+// C++
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+#include "libmesh/auto_ptr.h"
+#include "libmesh/id_types.h"
+
+// libMesh forward declarations
+class GetPot;
+
+namespace libMesh
+{
+  template <typename T> class LinearSolver;
+  template <typename T> class NumericVector;
+}
+
+namespace GRINS
+{
+  // Forward declarations
+  class MultiphysicsSystem;
+
+  //! Structured solver records, one per Newton iteration, nonlinear solve, time step and adaptive cycle
+  /*!
+    Records are written by processor 0 either as JSON lines or as CSV
+    with a fixed set of columns (fields that don't apply to a record type
+    are left empty). Every record has a "type" and the index of the
+    nonlinear "solve" it belongs to (or, for time steps and adaptive
+    cycles, the last solve), so the Newton records of a time step can be
+    matched to it.
+
+      - newton: residual norm at the start of the iteration, in total
+        and per variable group (residual_norm_<group>, the field-split
+        groups registered by the Physics), the norm of the step taken,
+        linear iterations and tolerance, line search backtracks,
+        assembly and remaining (linear solve) wall time
+      - nonlinear_solve: Newton iterations, final residual norm, status
+        returned by the DiffSolver, wall time
+      - time_step, adaptive_cycle: time or error estimate, wall time
+    All records also carry the number of dofs and the memory high-water
+    mark (maximum over processors of the resident set size, in kB).
+
+    The linear tolerance is only known with PETSc.
+
+    Options are read from the [Telemetry] section:
+      - enabled: turn telemetry on (default false)
+      - output_file: (default telemetry.jsonl)
+      - format: jsonl (default) or csv
+   */
+  class Telemetry
+  {
+  public:
+
+    Telemetry( const GetPot& input );
+    ~Telemetry();
+
+    bool is_enabled() const;
+
+    //! Resolve the variable groups and open the output
+    /*! This *must* be called after equation_system->init in order to
+        get variable indices. */
+    void init( MultiphysicsSystem& system );
+
+    //! Called by NewtonSolver before each nonlinear solve
+    void begin_nonlinear_solve( libMesh::LinearSolver<libMesh::Number>* linear_solver );
+
+    //! Called by NewtonSolver after each nonlinear solve, with the DiffSolver status
+    void end_nonlinear_solve( unsigned int status );
+
+    //! Called by MultiphysicsSystem after each assembly
+    /*! newton_start is true for the residual and Jacobian assembly that
+        starts each Newton iteration (even if the Jacobian was reused). */
+    void assembly_done( bool newton_start, bool get_residual, double seconds );
+
+    void time_step( unsigned int step, libMesh::Real time, libMesh::Real deltat, double seconds );
+
+    void adaptive_cycle( unsigned int cycle, libMesh::Real error_estimate, double seconds );
+
+  protected:
+
+    typedef std::map<std::string,std::string> Record;
+
+    void write_record( const std::string& type, Record& record );
+
+    void write_header();
+
+    //! Close the current Newton iteration and write its record
+    void finish_newton_iteration();
+
+    //! Residual norm of each variable group, in _group_names order
+    void group_residual_norms( std::vector<libMesh::Real>& norms );
+
+    //! Map local dofs to variable groups, if the dof distribution changed
+    void update_dof_groups();
+
+    unsigned int total_inner_iterations() const;
+
+    //! Maximum over processors of the resident set size high-water mark, in kB
+    long max_rss() const;
+
+    template <typename T>
+    static std::string to_string( T value );
+
+    bool _enabled;
+
+    std::string _output_file;
+
+    bool _csv;
+
+    std::vector<std::string> _columns;
+
+    std::ofstream _output;
+
+    MultiphysicsSystem* _system;
+
+    std::vector<std::string> _group_names;
+
+    //! Variables of each group, same order as _group_names
+    std::vector<std::vector<unsigned int> > _group_vars;
+
+    //! Group index of each local dof, _group_names.size() if none
+    std::vector<unsigned int> _dof_groups;
+
+    //! First local dof, i.e. the dof of _dof_groups[0]
+    libMesh::dof_id_type _dof_groups_first_dof;
+
+    //! Not owned, may be NULL
+    libMesh::LinearSolver<libMesh::Number>* _linear_solver;
+
+    unsigned int _n_solves;
+
+    bool _in_solve;
+
+    double _solve_start;
+
+    double _solve_assembly_time;
+
+    // State of the current Newton iteration
+    bool _in_iteration;
+    unsigned int _iteration;
+    libMesh::Real _iteration_residual;
+    std::vector<libMesh::Real> _iteration_group_residuals;
+    unsigned int _iteration_inner_start;
+    unsigned int _iteration_residual_assemblies;
+    double _iteration_assembly_time;
+    double _iteration_residual_assembly_time;
+    double _iteration_solve_start;
+
+    //! Residual norm of the most recent residual assembly
+    libMesh::Real _last_residual;
+
+    //! Solution at the start of the current Newton iteration
+    libMesh::AutoPtr<libMesh::NumericVector<libMesh::Number> > _iterate;
+
+  private:
+
+    Telemetry();
+
+  };
+
+  inline
+  bool Telemetry::is_enabled() const
+  {
+    return _enabled;
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_TELEMETRY_H
@@ -0,0 +1,73 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_UNSTEADY_MESH_ADAPTIVE_SOLVER_H
+#define GRINS_UNSTEADY_MESH_ADAPTIVE_SOLVER_H
+
+// GRINS
+#include "grins/grins_unsteady_solver.h"
+#include "grins/mesh_adaptive_solver_base.h"
+
+namespace GRINS
+{
+  // Forward declartions
+  class SolverContext;
+
+  //! Time stepping with periodic mesh refinement and coarsening
+  /*!
+    Takes the time steps of UnsteadySolver, with all of its unsteady-solver
+    options, and every MeshAdaptivity/refine_interval steps estimates the
+    error of the current solution, refines and coarsens the mesh and
+    continues. The current and old time step solutions (and any other
+    projected vectors) are projected onto the new mesh when the
+    EquationSystems is reinit'ed, which also repartitions the mesh.
+    Adjoint based error estimators are not supported.
+   */
+  class UnsteadyMeshAdaptiveSolver : public UnsteadySolver,
+                                     public MeshAdaptiveSolverBase
+  {
+  public:
+
+    UnsteadyMeshAdaptiveSolver( const GetPot& input );
+
+    virtual ~UnsteadyMeshAdaptiveSolver();
+
+    virtual void solve( SolverContext& context );
+
+  protected:
+
+    //! Adapt the mesh every _refine_interval steps, except after the last
+    virtual void end_timestep( SolverContext& context, unsigned int t_step );
+
+    //! Estimate error, refine and coarsen, and project onto the new mesh
+    void adapt_mesh( SolverContext& context, unsigned int t_step );
+
+    //! Number of time steps between mesh adaptations
+    unsigned int _refine_interval;
+
+  };
+
+} // end namespace GRINS
+#endif // GRINS_UNSTEADY_MESH_ADAPTIVE_SOLVER_H
@@ -0,0 +1,43 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_MEMORY_UTILS_H
+#define GRINS_MEMORY_UTILS_H
+
+// C++
+#include <cstddef>
+
+namespace GRINS
+{
+  //! Current resident set size of this process in bytes, 0 where unknown
+  /*! Read from /proc/self/statm, so only available on Linux. */
+  std::size_t resident_memory();
+
+  //! High-water mark of the resident set size of this process in bytes
+  std::size_t peak_resident_memory();
+
+} // namespace GRINS
+
+#endif // GRINS_MEMORY_UTILS_H
@@ -0,0 +1,44 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_PETSC_UTILS_H
+#define GRINS_PETSC_UTILS_H
+
+// C++
+#include <string>
+
+namespace GRINS
+{
+  /*!
+    Set a PETSc option in the global options database, unless the user
+    already set it (e.g. on the command line). Used by the preconditioner
+    presets so that any of their defaults can still be overridden.
+    Does nothing if libMesh was not built with PETSc.
+  */
+  void set_default_petsc_option( const std::string& name, const std::string& value );
+
+} //namespace GRINS
+
+#endif //GRINS_PETSC_UTILS_H
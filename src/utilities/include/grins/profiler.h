@@ -0,0 +1,237 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+
+#ifndef GRINS_PROFILER_H
+#define GRINS_PROFILER_H
+
+// C++
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+
+// libMesh forward declarations
+class GetPot;
+
+namespace libMesh
+{
+  namespace Parallel
+  {
+    class Communicator;
+  }
+}
+
+namespace GRINS
+{
+  //! Accumulated times and call counts of each Profiler timer
+  /*!
+    Each assembly thread fills its own buffer (see AssemblyContext::profile_buffer)
+    so that timing never needs a lock; buffers are merged into the Profiler
+    when the thread is done.
+   */
+  class ProfileBuffer
+  {
+  public:
+
+    ProfileBuffer();
+    ~ProfileBuffer();
+
+    void add( unsigned int timer, double seconds );
+
+    //! Add the times and call counts of another buffer
+    void merge( const ProfileBuffer& other );
+
+    void clear();
+
+    const std::vector<double>& times() const;
+
+    const std::vector<unsigned long>& calls() const;
+
+  protected:
+
+    std::vector<double> _times;
+
+    std::vector<unsigned long> _calls;
+
+  };
+
+  //! Adds the wall time between construction and destruction to a ProfileBuffer
+  /*! Does nothing if the buffer is NULL, i.e. when profiling is disabled. */
+  class ProfileTimer
+  {
+  public:
+
+    ProfileTimer( ProfileBuffer* buffer, unsigned int timer );
+    ~ProfileTimer();
+
+  protected:
+
+    ProfileBuffer* _buffer;
+
+    unsigned int _timer;
+
+    double _start;
+
+  private:
+
+    ProfileTimer();
+
+  };
+
+  //! Hierarchical timers for assembly, QoIs and solvers
+  /*!
+    Timers are registered by name before they are used; "/" separates
+    the levels of the hierarchy, e.g. "assembly/HeatTransfer/side_time_derivative".
+    A parent does not need a timer of its own. Timers must be registered
+    in the same order on every processor.
+
+    At the end of the run, times are reduced across processors (min, max
+    and mean) and call counts are summed, and processor 0 writes the
+    report as JSON. Counters, such as solver iteration counts, are
+    written as given on processor 0.
+
+    Options, in profiling/:
+      - enabled: turn on the timers (default false)
+      - output_file: JSON report file name (default profile.json)
+   */
+  class Profiler
+  {
+  public:
+
+    Profiler( const GetPot& input );
+    ~Profiler();
+
+    bool is_enabled() const;
+
+    //! Returns the index of the named timer, registering it if needed
+    unsigned int register_timer( const std::string& name );
+
+    //! Add a thread's timings. Thread safe.
+    void merge( const ProfileBuffer& buffer );
+
+    //! Set a named counter, e.g. the total number of Newton iterations
+    void set_counter( const std::string& name, unsigned long value );
+
+    //! Buffer for code outside of threaded loops, NULL if disabled
+    ProfileBuffer* buffer();
+
+    //! Reduce all timers across processors and write the JSON report
+    void write_report( const libMesh::Parallel::Communicator& comm );
+
+    //! Wall clock time in seconds
+    static double wall_time();
+
+  protected:
+
+    //! Write the subtree of timers whose names start with prefix
+    void write_children( std::ostream& out,
+                         const std::string& prefix,
+                         unsigned int indent,
+                         const std::vector<double>& min_times,
+                         const std::vector<double>& max_times,
+                         const std::vector<double>& sum_times,
+                         const std::vector<unsigned long>& calls,
+                         unsigned int n_processors ) const;
+
+    bool _enabled;
+
+    std::string _output_file;
+
+    std::vector<std::string> _names;
+
+    std::map<std::string,unsigned int> _timer_ids;
+
+    ProfileBuffer _totals;
+
+    std::map<std::string,unsigned long> _counters;
+
+  private:
+
+    Profiler();
+
+  };
+
+  inline
+  const std::vector<double>& ProfileBuffer::times() const
+  {
+    return _times;
+  }
+
+  inline
+  const std::vector<unsigned long>& ProfileBuffer::calls() const
+  {
+    return _calls;
+  }
+
+  inline
+  void ProfileBuffer::add( unsigned int timer, double seconds )
+  {
+    if( timer >= _times.size() )
+      {
+        _times.resize( timer+1, 0.0 );
+        _calls.resize( timer+1, 0 );
+      }
+
+    _times[timer] += seconds;
+    _calls[timer]++;
+  }
+
+  inline
+  ProfileTimer::ProfileTimer( ProfileBuffer* buffer, unsigned int timer )
+    : _buffer(buffer),
+      _timer(timer),
+      _start( buffer ? Profiler::wall_time() : 0.0 )
+  {
+    return;
+  }
+
+  inline
+  ProfileTimer::~ProfileTimer()
+  {
+    if( _buffer )
+      _buffer->add( _timer, Profiler::wall_time() - _start );
+
+    return;
+  }
+
+  inline
+  bool Profiler::is_enabled() const
+  {
+    return _enabled;
+  }
+
+  inline
+  ProfileBuffer* Profiler::buffer()
+  {
+    return _enabled ? &_totals : NULL;
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_PROFILER_H
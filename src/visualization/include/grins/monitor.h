@@ -0,0 +1,185 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_MONITOR_H
+#define GRINS_MONITOR_H
+
+// C++
+#include <string>
+#include <vector>
+#include <set>
+#include <fstream>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+#include "libmesh/point.h"
+#include "libmesh/id_types.h"
+
+// GRINS
+#include "grins/var_typedefs.h"
+#include "grins/postprocessed_quantities.h"
+
+// libMesh forward declarations
+class GetPot;
+
+namespace GRINS
+{
+  // Forward declarations
+  class MultiphysicsSystem;
+  class AssemblyContext;
+
+  //! Lightweight in-situ reductions written as a time series
+  /*!
+    Computes, at each requested step, domain integrals, extrema, boundary
+    fluxes and point probes of solution variables and registered
+    postprocessed quantities, together with the current QoI values.
+    Everything is reduced across processors and rank 0 appends a single
+    record to the output file. This is intended for quantities needed
+    at every time step, where dumping full fields through Visualization
+    would be far too expensive.
+
+    Options are read from the [Monitor] section:
+      - enabled: turn the monitor on (default false)
+      - output_file: name of the time-series file (default monitor.dat)
+      - format: csv (default) or binary. The binary format is a single
+        ASCII header line with the column names followed by one record
+        of native doubles per output step.
+      - steps_per_output: output frequency in time steps (default 1)
+      - integrate_vars: domain integrals of each named quantity
+      - extrema_vars: min/max over quadrature points of each named quantity
+      - flux_vars, flux_bc_ids: integral of grad(var).n over the given boundaries
+      - probe_vars, probe_points: point values, probe_points is a flat list
+        of 3*n_probes coordinates
+      - include_qois: append the CompositeQoI values (default false)
+
+    Quantity names may be either solution variable names or quantities
+    registered with PostProcessedQuantities through a Physics output_vars.
+   */
+  class Monitor
+  {
+  public:
+
+    Monitor( const GetPot& input );
+    virtual ~Monitor();
+
+    //! Resolve quantity names and cache probe elements
+    /*! This *must* be called after equation_system->init in order to
+        get variable indices. */
+    virtual void init( MultiphysicsSystem& system,
+                       PostProcessedQuantities<libMesh::Real>& postprocessing );
+
+    //! Refresh cached probe element lookups after the mesh changed.
+    virtual void reinit();
+
+    //! Compute and append a record if this is an output step
+    virtual void output( unsigned int step, libMesh::Real time );
+
+    //! Compute and append a record unconditionally
+    virtual void output_now( unsigned int step, libMesh::Real time );
+
+    bool is_enabled() const;
+
+  protected:
+
+    //! A quantity is either a solution variable or a postprocessed quantity.
+    struct Quantity
+    {
+      std::string name;
+      bool is_variable;
+      unsigned int index;
+    };
+
+    void parse_quantities( const GetPot& input, const std::string& option,
+                           std::vector<Quantity>& quantities );
+
+    void resolve_quantity( Quantity& quantity, bool require_variable );
+
+    void request_fe_data( AssemblyContext& context, const std::vector<Quantity>& quantities );
+
+    void locate_probes();
+
+    libMesh::Real interior_value( const Quantity& quantity,
+                                  AssemblyContext& context,
+                                  unsigned int qp,
+                                  const libMesh::Point& point );
+
+    libMesh::Real point_value( const Quantity& quantity,
+                               AssemblyContext& context,
+                               const libMesh::Point& point );
+
+    void compute_values( std::vector<libMesh::Real>& values );
+
+    void write_header();
+
+    void write_record( const std::vector<libMesh::Real>& values );
+
+    bool _enabled;
+
+    std::string _output_file;
+
+    bool _binary;
+
+    unsigned int _steps_per_output;
+
+    bool _include_qois;
+
+    //! Append to an existing file when restarting
+    bool _append;
+
+    std::vector<Quantity> _integrate_quantities;
+    std::vector<Quantity> _extrema_quantities;
+    std::vector<Quantity> _flux_quantities;
+    std::vector<Quantity> _probe_quantities;
+
+    std::set<libMesh::boundary_id_type> _flux_bc_ids;
+
+    std::vector<libMesh::Point> _probe_points;
+
+    //! Cached element containing each probe, NULL if not owned by this processor
+    std::vector<const libMesh::Elem*> _probe_elems;
+
+    std::vector<std::string> _column_names;
+
+    MultiphysicsSystem* _system;
+
+    PostProcessedQuantities<libMesh::Real>* _postprocessing;
+
+    std::ofstream _output;
+
+  private:
+
+    Monitor();
+
+  };
+
+  inline
+  bool Monitor::is_enabled() const
+  {
+    return _enabled;
+  }
+
+} // namespace GRINS
+
+#endif // GRINS_MONITOR_H
@@ -78,6 +78,12 @@ namespace GRINS
      */
     unsigned int register_quantity( std::string name );
 
+    //! Check if a quantity with the given name has been registered
+    bool has_quantity( const std::string& name ) const;
+
+    //! Index of a registered quantity, as returned by register_quantity
+    unsigned int quantity_index( const std::string& name ) const;
+
     virtual void initialize( MultiphysicsSystem& system,
 			     libMesh::EquationSystems& equation_systems );
 
@@ -41,6 +41,8 @@ namespace GRINS
 {
   // Forward declarations
   class MultiphysicsSystem;
+  class Profiler;
+  class ProfileBuffer;
 
   class Visualization
   {
@@ -64,12 +66,30 @@ namespace GRINS
 
     void dump_visualization( std::tr1::shared_ptr<libMesh::EquationSystems> equation_system,
 			     const std::string& filename_prefix, const libMesh::Real time );
+
+    //! Time all visualization output under the "output" timer
+    void attach_profiler( Profiler& profiler );
     
   protected:
 
+    //! Write the residual captured by the MultiphysicsSystem during the last solve
+    /*!
+      The captured residual is swapped in for the solution, together with a
+      localized copy for current_local_solution, so no reassembly or
+      EquationSystems::update() is required.
+     */
+    void dump_steady_residual( std::tr1::shared_ptr<libMesh::EquationSystems> equation_system,
+                               GRINS::MultiphysicsSystem* system,
+                               const std::string& filename_prefix, const libMesh::Real time );
+
     // Visualization options
     std::string _vis_output_file_prefix;
     std::vector<std::string> _output_format;
+
+    //! NULL unless a Profiler was attached
+    ProfileBuffer* _profile_buffer;
+
+    unsigned int _output_timer;
   };
 }// namespace GRINS
 #endif // GRINS_VISUALIZATION_H